@@ -0,0 +1,158 @@
+// MIT License
+//
+// Copyright (c) 2024 Rovshan Rustamov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+// Description: Microbenchmark for the hex/binary <-> s_vpi_vecval conversions
+// used by AwaitWrite and AwaitRead. Each width is timed on the direct kernels
+// and on the string-based path they replaced (hex_to_bin plus a per-character
+// pack, a per-bit unpack plus bin_to_hex).
+
+#include "testbase.hpp"
+#include "vecvalcodec.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+  // Keep results alive so the timed loops are not optimized away
+  volatile unsigned int sink;
+
+  // The pre-kernel write path: one character and one bit at a time
+  void pack_binary_string(const std::string& value, const unsigned int vecval_len, s_vpi_vecval* out) {
+    for (unsigned int i = 0; i < vecval_len; ++i) {
+      out[i] = s_vpi_vecval{0, 0};
+    }
+    std::size_t bit_index = 0;
+    for (auto it = value.rbegin(); it != value.rend() && bit_index < vecval_len * 32u; ++it, ++bit_index) {
+      const auto bit_mask = static_cast<PLI_INT32>(1u << (bit_index % 32));
+      s_vpi_vecval& chunk = out[bit_index / 32];
+      switch (*it) {
+      case '1':
+        chunk.aval |= bit_mask;
+        break;
+      case 'x':
+        chunk.aval |= bit_mask;
+        chunk.bval |= bit_mask;
+        break;
+      case 'z':
+        chunk.bval |= bit_mask;
+        break;
+      default:
+        break;
+      }
+    }
+  }
+
+  // The pre-kernel read path
+  std::string unpack_binary_string(const s_vpi_vecval* in, const unsigned int vecval_len) {
+    std::string bin;
+    bin.reserve(vecval_len * 32u);
+    for (int i = static_cast<int>(vecval_len) - 1; i >= 0; --i) {
+      for (int j = 31; j >= 0; --j) {
+        const bool a_bit = (static_cast<unsigned int>(in[i].aval) >> j) & 1u;
+        const bool b_bit = (static_cast<unsigned int>(in[i].bval) >> j) & 1u;
+        if (b_bit) {
+          bin.push_back(a_bit ? 'x' : 'z');
+        }
+        else {
+          bin.push_back(a_bit ? '1' : '0');
+        }
+      }
+    }
+    return bin;
+  }
+
+  template <typename F>
+  double ns_per_op(const unsigned int width, F&& op) {
+    // Roughly 64M characters of work per measurement
+    const long iterations = std::max(1000L, (64L << 20) / static_cast<long>(width));
+    op(); // warm up
+    const auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < iterations; ++i) {
+      op();
+    }
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / static_cast<double>(iterations);
+  }
+} // namespace
+
+int main() {
+  using test::TestBase;
+  namespace detail = test::detail;
+
+  std::mt19937 rng(2024);
+  std::printf("%-6s %-18s %12s %12s %8s\n", "bits", "conversion", "string ns", "direct ns", "speedup");
+
+  for (const unsigned int width : {8u, 64u, 1024u, 4096u}) {
+    const unsigned int vecval_len = (width + 31) / 32;
+    std::string hex(width / 4, '0');
+    for (char& c : hex) {
+      c = "0123456789abcdef"[rng() % 16];
+    }
+    const std::string bin = TestBase::hex_to_bin(hex);
+    std::vector<s_vpi_vecval> vecval(vecval_len);
+    std::string chars(static_cast<std::size_t>(vecval_len) * 32, '0');
+
+    const auto report = [&](const char* name, const double before, const double after) {
+      std::printf("%-6u %-18s %12.1f %12.1f %7.1fx\n", width, name, before, after, before / after);
+    };
+
+    report("hex -> vecval",
+           ns_per_op(width, [&] {
+             pack_binary_string(TestBase::hex_to_bin(hex), vecval_len, vecval.data());
+             sink = vecval[0].aval;
+           }),
+           ns_per_op(width, [&] {
+             detail::hex_to_vecval(hex, vecval.data(), vecval_len);
+             sink = vecval[0].aval;
+           }));
+
+    report("bin -> vecval",
+           ns_per_op(width, [&] {
+             pack_binary_string(bin, vecval_len, vecval.data());
+             sink = vecval[0].aval;
+           }),
+           ns_per_op(width, [&] {
+             detail::bin_to_vecval(bin, vecval.data(), vecval_len);
+             sink = vecval[0].aval;
+           }));
+
+    report("vecval -> bin",
+           ns_per_op(width, [&] { sink = unpack_binary_string(vecval.data(), vecval_len).back(); }),
+           ns_per_op(width, [&] {
+             detail::vecval_to_bin(vecval.data(), vecval_len, chars.data());
+             sink = chars.back();
+           }));
+
+    report("vecval -> hex",
+           ns_per_op(width, [&] {
+             sink = TestBase::bin_to_hex(unpack_binary_string(vecval.data(), vecval_len)).back();
+           }),
+           ns_per_op(width, [&] { sink = detail::vecval_to_hex(vecval.data(), vecval_len).back(); }));
+  }
+
+  return 0;
+}
@@ -0,0 +1,136 @@
+// MIT License
+//
+// Copyright (c) 2024 Rovshan Rustamov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+
+// Description: Net-handle benchmark, built as a VPI library (libnet_bench.so)
+// for read_bench_top.sv. Each iteration writes four nets, reads them back and
+// decodes them, once through the name-keyed overloads (a netMap lookup per
+// call) and once through the Net handles returned by addNet. For example,
+// with Icarus Verilog:
+//   iverilog -o read_bench.vvp read_bench_top.sv
+//   vvp -M <build>/bench -m libnet_bench.so read_bench.vvp
+
+#include "testbase.hpp"
+#include "core.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+
+namespace test {
+  class NetBench : public TestBase {
+  public:
+    static constexpr int iterations = 200000;
+
+    NetBench() {
+      registerTest("net_bench", [this]() { return run().handle; });
+    }
+
+    void initNets() override {
+      setDutName("read_bench_top");
+      for (std::size_t i = 0; i < names.size(); ++i) {
+        nets[i] = addNet(names[i], widths[i]);
+      }
+    }
+
+  private:
+    static constexpr std::array<const char*, 4> names = {"g[0].byte8", "g[1].byte8", "g[0].word32", "g[1].word32"};
+    static constexpr std::array<unsigned int, 4> widths = {8, 8, 32, 32};
+
+    std::array<Net, 4> nets{};
+    unsigned long long sink = 0;
+
+    RunUserTask by_name(double& ns_per_iter) {
+      const std::array<std::string, 4> keys = {names[0], names[1], names[2], names[3]};
+
+      const auto start = std::chrono::steady_clock::now();
+      for (int iter = 0; iter < iterations; ++iter) {
+        auto wr = getCoWrite<ticks>(1);
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+          wr.write(keys[i], static_cast<unsigned long long int>(iter + i));
+        }
+        co_await wr;
+
+        auto rd = getCoRead();
+        for (const std::string& key : keys) {
+          rd.read(key);
+        }
+        co_await rd;
+        for (const std::string& key : keys) {
+          sink += rd.getNum(key);
+        }
+      }
+      const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+      ns_per_iter = elapsed.count() / iterations;
+      co_return;
+    }
+
+    RunUserTask by_handle(double& ns_per_iter) {
+      const auto start = std::chrono::steady_clock::now();
+      for (int iter = 0; iter < iterations; ++iter) {
+        auto wr = getCoWrite<ticks>(1);
+        for (std::size_t i = 0; i < nets.size(); ++i) {
+          wr.write(nets[i], static_cast<unsigned long long int>(iter + i));
+        }
+        co_await wr;
+
+        auto rd = getCoRead();
+        for (const Net& net : nets) {
+          rd.read(net);
+        }
+        co_await rd;
+        for (const Net& net : nets) {
+          sink += rd.getNum(net);
+        }
+      }
+      const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+      ns_per_iter = elapsed.count() / iterations;
+      co_return;
+    }
+
+    RunTask run() {
+      std::printf("[INFO]\tnet_bench: %d iterations of %zu writes, reads and decodes\n", iterations, nets.size());
+
+      double name_ns = 0.0;
+      double handle_ns = 0.0;
+      co_await by_name(name_ns);
+      co_await by_handle(handle_ns);
+
+      std::printf("[INFO]\tnet_bench: name keys %10.1f ns/iter, Net handles %10.1f ns/iter (%.2fx)\n",
+                  name_ns, handle_ns, name_ns / handle_ns);
+      std::printf("[INFO]\tnet_bench: checksum %llu\n", sink);
+      printNetStats();
+
+      core::finishSimulation();
+      co_return;
+    }
+  };
+} // namespace test
+
+extern "C" void userRegisterFactory() {
+  core::registerTestFactory([]() { return std::make_unique<test::NetBench>(); });
+}
@@ -0,0 +1,119 @@
+// MIT License
+//
+// Copyright (c) 2024 Rovshan Rustamov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+// Description: Read-throughput benchmark, built as a VPI library
+// (libread_bench.so) for read_bench_top.sv. Each net kind is read in
+// rounds of one AwaitRead covering all of its copies, first with
+// vpiVectorVal forced on every net (the format used for all reads before
+// per-net formats) and then with the cheapest format for the width:
+// vpiScalarVal for 1 bit, the opt-in vpiIntVal up to 32 bits. For
+// example, with Icarus Verilog:
+//   iverilog -o read_bench.vvp read_bench_top.sv
+//   vvp -M <build>/bench -m libread_bench.so read_bench.vvp
+
+#include "testbase.hpp"
+#include "core.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace test {
+  class ReadBench : public TestBase {
+  public:
+    static constexpr int copies = 32; // generate copies in read_bench_top.sv
+    static constexpr int rounds = 20000;
+
+    ReadBench() {
+      registerTest("read_bench", [this]() { return run().handle; });
+    }
+
+    void initNets() override {
+      setDutName("read_bench_top");
+      for (Kind& kind : kinds) {
+        for (int i = 0; i < copies; ++i) {
+          kind.nets.push_back(addNet("g[" + std::to_string(i) + "]." + kind.name, kind.width));
+        }
+      }
+    }
+
+  private:
+    struct Kind {
+      const char* name;
+      unsigned int width;
+      std::vector<Net> nets;
+    };
+
+    Kind kinds[4] = {{"bit1", 1, {}}, {"byte8", 8, {}}, {"word32", 32, {}}, {"wide128", 128, {}}};
+    unsigned long long sink = 0;
+
+    RunUserTask measure(Kind& kind, const PLI_INT32 format, double& reads_per_s) {
+      for (const Net& net : kind.nets) {
+        setNetFormat(net, format);
+      }
+
+      const auto start = std::chrono::steady_clock::now();
+      for (int round = 0; round < rounds; ++round) {
+        auto rd = getCoRead<ticks>(1);
+        for (const Net& net : kind.nets) {
+          rd.read(net);
+        }
+        co_await rd;
+        for (const Net& net : kind.nets) {
+          sink += rd.getNum(net);
+        }
+      }
+      const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+      reads_per_s = static_cast<double>(rounds) * copies / elapsed.count();
+      co_return;
+    }
+
+    RunTask run() {
+      std::printf("[INFO]\tread_bench: %d rounds x %d nets per kind\n", rounds, copies);
+      for (Kind& kind : kinds) {
+        const PLI_INT32 fast_format =
+          kind.width == 1 ? vpiScalarVal : kind.width <= 32 ? vpiIntVal : vpiVectorVal;
+        double vector_rate = 0.0;
+        double fast_rate = 0.0;
+        co_await measure(kind, vpiVectorVal, vector_rate);
+        co_await measure(kind, fast_format, fast_rate);
+
+        const char* fast_name =
+          fast_format == vpiScalarVal ? "vpiScalarVal" : fast_format == vpiIntVal ? "vpiIntVal" : "vpiVectorVal";
+        std::printf("[INFO]\tread_bench: %-8s vpiVectorVal %12.0f reads/s, %-12s %12.0f reads/s (%.2fx)\n",
+                    kind.name, vector_rate, fast_name, fast_rate, fast_rate / vector_rate);
+      }
+      std::printf("[INFO]\tread_bench: checksum %llu\n", sink);
+
+      core::finishSimulation();
+      co_return;
+    }
+  };
+} // namespace test
+
+extern "C" void userRegisterFactory() {
+  core::registerTestFactory([]() { return std::make_unique<test::ReadBench>(); });
+}
@@ -0,0 +1,38 @@
+// MIT License
+//
+// Copyright (c) 2024 Rovshan Rustamov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+// Description: Top level for the read_bench and net_bench VPI benchmarks: 32
+// copies each of a 1-bit, 8-bit, 32-bit and 128-bit register. read_bench
+// only reads their initial values; net_bench also writes some of them.
+
+module read_bench_top;
+  genvar i;
+  generate
+    for (i = 0; i < 32; i = i + 1) begin : g
+      reg         bit1    = 1'b1;
+      reg [7:0]   byte8   = 8'h5A;
+      reg [31:0]  word32  = 32'hDEADBEEF;
+      reg [127:0] wide128 = {4{32'hCAFEF00D}};
+    end
+  endgenerate
+endmodule
@@ -22,6 +22,7 @@
 
 #include "core.hpp"
 
+#include <chrono>
 #include <cstdio>
 
 namespace core {
@@ -56,7 +57,21 @@ namespace core {
 #endif
 
     // Initialize all the Nets which user entered in Test class
+    const auto nets_start = std::chrono::steady_clock::now();
     dut->initNets();
+    const auto nets_us = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - nets_start).count();
+
+    const char* resolution_name = "eager";
+    if (dut->netResolution() == test::NetResolution::lazy) {
+      resolution_name = "lazy";
+    }
+    else if (dut->netResolution() == test::NetResolution::discover) {
+      resolution_name = "discover";
+    }
+    std::printf("[INFO]\tRapidVPI nets: resolution=%s declared=%zu resolved=%zu discovered=%zu init_us=%lld\n",
+                resolution_name, dut->netsDeclared(), dut->netsResolved(), dut->netsDiscovered(),
+                static_cast<long long>(nets_us));
 
     auto& testManager = test::TestManager::getInstance();
 #ifdef RAPIDVPI_DEBUG
@@ -73,6 +88,22 @@ namespace core {
     return 0;
   }
 
+  PLI_INT32 sim_end(p_cb_data data) {
+#ifdef RAPIDVPI_STATS
+    scheduler::print_pool_stats();
+    scheduler::print_edge_hub_stats();
+    scheduler::print_timer_wheel_stats();
+    scheduler::print_read_sync_stats();
+    scheduler::print_write_buffer_stats();
+    scheduler::print_watch_stats();
+    test::frame_arena::print_stats();
+    if (dut) {
+      dut->printNetStats();
+    }
+#endif
+    return 0;
+  }
+
   void register_cb() {
     // Invoke the user-defined factory registration function
     userRegisterFactory();
@@ -85,6 +116,14 @@ namespace core {
     cb_data.value = nullptr;
     cb_data.user_data = nullptr;
 
+    if (vpiHandle cbH; (cbH = vpi_register_cb(&cb_data)) == nullptr)
+      printf("[WARNING] Cannot register VPI Callback: %s\n", __FUNCTION__);
+    else
+      vpi_free_object(cbH);
+
+    cb_data.reason = cbEndOfSimulation;
+    cb_data.cb_rtn = &sim_end;
+
     if (vpiHandle cbH; (cbH = vpi_register_cb(&cb_data)) == nullptr)
       printf("[WARNING] Cannot register VPI Callback: %s\n", __FUNCTION__);
     else
@@ -0,0 +1,127 @@
+// MIT License
+//
+// Copyright (c) 2024 Rovshan Rustamov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Description: Slab/freelist pool for the scheduler callback records. Records
+// are handed out on every await_suspend and returned from the VPI callback, so
+// after the first few slabs are carved the await path no longer touches the heap.
+
+#ifndef DUT_TOP_CALLBACKPOOL_HPP
+#define DUT_TOP_CALLBACKPOOL_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace scheduler {
+  struct CallbackPoolStats {
+    std::size_t live{}; // records currently handed out
+    std::size_t peak{}; // high-water mark of live records
+    std::size_t capacity{}; // records carved from slabs so far
+    std::size_t slabs{}; // number of slab allocations (heap hits)
+    std::uint64_t acquires{}; // total acquire() calls
+  };
+
+  template <typename T, std::size_t SlabSize = 64>
+  class CallbackPool {
+    static_assert(std::is_trivially_destructible_v<T>,
+                  "CallbackPool records must be trivially destructible");
+
+  public:
+    CallbackPool() = default;
+    CallbackPool(const CallbackPool&) = delete;
+    CallbackPool& operator=(const CallbackPool&) = delete;
+
+    // Pop a record from the freelist (carving a new slab if empty) and
+    // value-initialize it.
+    [[nodiscard]] T* acquire() {
+      if (free_ == nullptr) {
+        grow_();
+      }
+
+      Slot* slot = free_;
+      free_ = slot->next;
+
+      ++stats_.acquires;
+      if (++stats_.live > stats_.peak) {
+        stats_.peak = stats_.live;
+      }
+      return ::new(static_cast<void*>(slot->storage)) T{};
+    }
+
+    // Push a record back onto the freelist. Null is ignored.
+    void release(T* record) noexcept {
+      if (record == nullptr) {
+        return;
+      }
+
+      auto* slot = reinterpret_cast<Slot*>(record);
+      slot->next = free_;
+      free_ = slot;
+      --stats_.live;
+    }
+
+    [[nodiscard]] const CallbackPoolStats& stats() const noexcept { return stats_; }
+
+  private:
+    union Slot {
+      Slot* next;
+      alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    void grow_() {
+      auto slab = std::make_unique<Slot[]>(SlabSize);
+      for (std::size_t i = 0; i < SlabSize; ++i) {
+        slab[i].next = (i + 1 < SlabSize) ? &slab[i + 1] : free_;
+      }
+      free_ = &slab[0];
+      slabs_.push_back(std::move(slab));
+
+      stats_.capacity += SlabSize;
+      ++stats_.slabs;
+    }
+
+    Slot* free_{nullptr};
+    std::vector<std::unique_ptr<Slot[]>> slabs_;
+    CallbackPoolStats stats_{};
+  };
+
+  // Deleter so pooled records can ride in a unique_ptr until ownership is
+  // handed over to the simulator callback.
+  template <typename T>
+  struct PoolDeleter {
+    CallbackPool<T>* pool{nullptr};
+
+    void operator()(T* record) const noexcept {
+      if (pool != nullptr) {
+        pool->release(record);
+      }
+    }
+  };
+
+  template <typename T>
+  using PooledPtr = std::unique_ptr<T, PoolDeleter<T>>;
+} // namespace scheduler
+
+#endif // DUT_TOP_CALLBACKPOOL_HPP
@@ -0,0 +1,206 @@
+// MIT License
+//
+// Copyright (c) 2024 Rovshan Rustamov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "edgehub.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace scheduler {
+  namespace {
+    struct EdgeHub {
+      vpiHandle net{}; // watched net
+      vpiHandle cb_handle{}; // persistent cbValueChange, null while disarmed
+
+      // Persistent VPI time/value storage; must remain valid while registered.
+      s_vpi_time time{};
+      s_vpi_value vpi_value{};
+
+      // Waiters indexed by negedge/posedge/anyedge
+      std::vector<std::coroutine_handle<>> waiters[3];
+
+      // Lists detached for the pass being resumed. Swapped with 'waiters'
+      // on every edge, so both buffers keep their capacity and a steady
+      // clock loop allocates nothing per edge.
+      std::vector<std::coroutine_handle<>> firing[3];
+      bool waking{false};
+    };
+
+    // Nodes of unordered_map are stable, so the hub address can ride in
+    // the callback's user_data for the lifetime of the simulation.
+    std::unordered_map<vpiHandle, EdgeHub>& hubs() {
+      static std::unordered_map<vpiHandle, EdgeHub> map;
+      return map;
+    }
+
+    EdgeHubStats hub_stats{};
+
+    bool arm(EdgeHub& hub) {
+      hub.time.type = vpiSimTime;
+      hub.vpi_value.format = vpiScalarVal;
+
+      s_cb_data cb_data{};
+      cb_data.reason = cbValueChange;
+      cb_data.cb_rtn = &edge_hub_callback;
+      cb_data.obj = hub.net;
+      cb_data.time = &hub.time;
+      cb_data.value = &hub.vpi_value;
+      cb_data.user_data = reinterpret_cast<PLI_BYTE8*>(&hub);
+
+      hub.cb_handle = vpi_register_cb(&cb_data);
+      if (hub.cb_handle == nullptr) {
+        return false;
+      }
+
+      ++hub_stats.arms;
+      return true;
+    }
+
+    void resume_all(std::vector<std::coroutine_handle<>>& list) {
+      hub_stats.wakeups += list.size();
+      for (const std::coroutine_handle<> h : list) {
+        h.resume();
+      }
+      list.clear();
+    }
+  } // namespace
+
+  bool edge_hub_wait(vpiHandle net, const int edge, std::coroutine_handle<> h) {
+    auto [it, inserted] = hubs().try_emplace(net);
+    EdgeHub& hub = it->second;
+
+    if (inserted) {
+      hub.net = net;
+      ++hub_stats.hubs;
+    }
+
+    if (hub.cb_handle == nullptr && !arm(hub)) {
+      std::printf("[WARNING]\tCannot register VPI Callback. scheduler::%s\n", __FUNCTION__);
+      return false;
+    }
+
+    hub.waiters[edge].push_back(h);
+    ++hub_stats.waits;
+    return true;
+  }
+
+  bool edge_hub_cancel(vpiHandle net, const int edge, std::coroutine_handle<> h) {
+    const auto it = hubs().find(net);
+    if (it == hubs().end()) {
+      return false;
+    }
+
+    // An idle hub disarms itself on its next edge, as after a normal wakeup
+    auto& list = it->second.waiters[edge];
+    const auto pos = std::find(list.begin(), list.end(), h);
+    if (pos == list.end()) {
+      return false;
+    }
+    list.erase(pos);
+    ++hub_stats.cancels;
+    return true;
+  }
+
+  const EdgeHubStats& edge_hub_stats() noexcept {
+    return hub_stats;
+  }
+
+  void print_edge_hub_stats() {
+    std::printf("[INFO]\tRapidVPI edge hub: hubs=%zu arms=%llu disarms=%llu callbacks=%llu waits=%llu wakeups=%llu cancels=%llu\n",
+                hub_stats.hubs,
+                static_cast<unsigned long long>(hub_stats.arms),
+                static_cast<unsigned long long>(hub_stats.disarms),
+                static_cast<unsigned long long>(hub_stats.callbacks),
+                static_cast<unsigned long long>(hub_stats.waits),
+                static_cast<unsigned long long>(hub_stats.wakeups),
+                static_cast<unsigned long long>(hub_stats.cancels));
+  }
+
+  // cbValueChange, persistent -> shared by all single-bit AwaitChange waiters
+  PLI_INT32 edge_hub_callback(p_cb_data data) {
+    auto* hub =
+      data
+        ? reinterpret_cast<EdgeHub*>(data->user_data)
+        : nullptr;
+
+    if (hub == nullptr) {
+      return 0;
+    }
+
+    ++hub_stats.callbacks;
+
+    const bool idle = hub->waiters[negedge].empty() &&
+                      hub->waiters[posedge].empty() &&
+                      hub->waiters[anyedge].empty();
+    if (idle) {
+      // Nobody waited on this net for a whole edge: stop paying for it
+      // until the next waiter re-arms the hub.
+      vpi_remove_cb(hub->cb_handle);
+      hub->cb_handle = nullptr;
+      ++hub_stats.disarms;
+      return 0;
+    }
+
+    // Same aval-bit comparison as the targeted cbValueChange path, so
+    // x reads as 1 and z as 0.
+    s_vpi_value read_val{};
+    read_val.format = vpiScalarVal;
+    vpi_get_value(hub->net, &read_val);
+    const int level = (read_val.value.scalar == vpi1 || read_val.value.scalar == vpiX) ? posedge : negedge;
+
+#ifdef RAPIDVPI_DEBUG
+    std::printf("[DBG] edge_hub_callback: net=%p level=%d waiters=%zu/%zu/%zu\n",
+                static_cast<void*>(hub->net), level,
+                hub->waiters[negedge].size(),
+                hub->waiters[posedge].size(),
+                hub->waiters[anyedge].size());
+#endif
+
+    // Detach both lists before resuming anyone: a waiter resumed for its
+    // level that waits again on this net, on any edge, must wait for the
+    // next change rather than be resumed again from the any-edge list.
+    if (hub->waking) {
+      // Re-entered by a write from a waiter of this pass; its firing
+      // buffers are in use
+      std::vector<std::coroutine_handle<>> level_list;
+      std::vector<std::coroutine_handle<>> any_list;
+      level_list.swap(hub->waiters[level]);
+      any_list.swap(hub->waiters[anyedge]);
+      resume_all(level_list);
+      resume_all(any_list);
+      return 0;
+    }
+
+    hub->firing[level].swap(hub->waiters[level]);
+    hub->firing[anyedge].swap(hub->waiters[anyedge]);
+
+    hub->waking = true;
+    resume_all(hub->firing[level]);
+    resume_all(hub->firing[anyedge]);
+    hub->waking = false;
+    return 0;
+  }
+} // namespace scheduler
@@ -0,0 +1,69 @@
+// MIT License
+//
+// Copyright (c) 2024 Rovshan Rustamov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+// Description: Per-net edge hub. Every single-bit AwaitChange on a net shares
+// one persistent cbValueChange; on each change the hub wakes all waiters for
+// that edge in a single pass instead of each waiter registering and removing
+// its own VPI callback.
+
+#ifndef DUT_TOP_EDGEHUB_HPP
+#define DUT_TOP_EDGEHUB_HPP
+
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+
+#include <vpi_user.h>
+
+namespace scheduler {
+  // Edge selectors for edge_hub_wait(); 0/1 match the targeted AwaitChange value.
+  inline constexpr int negedge = 0;
+  inline constexpr int posedge = 1;
+  inline constexpr int anyedge = 2;
+
+  struct EdgeHubStats {
+    std::size_t hubs{}; // nets with a hub
+    std::uint64_t arms{}; // vpi_register_cb calls made by hubs
+    std::uint64_t disarms{}; // hubs disarmed after an edge with no waiters
+    std::uint64_t callbacks{}; // cbValueChange callbacks serviced
+    std::uint64_t waits{}; // waiters queued
+    std::uint64_t wakeups{}; // waiters resumed
+    std::uint64_t cancels{}; // waiters withdrawn before their edge
+  };
+
+  // Suspend 'h' until 'net' next changes to 'edge'. The hub arms its callback
+  // on first use and keeps it armed while the net has waiters. Returns false
+  // if the VPI callback could not be registered.
+  bool edge_hub_wait(vpiHandle net, int edge, std::coroutine_handle<> h);
+
+  // Withdraw a wait queued by edge_hub_wait(). Returns false if 'h' is not
+  // queued any more (its edge fired, possibly in the pass now resuming).
+  bool edge_hub_cancel(vpiHandle net, int edge, std::coroutine_handle<> h);
+
+  [[nodiscard]] const EdgeHubStats& edge_hub_stats() noexcept;
+  void print_edge_hub_stats();
+
+  PLI_INT32 edge_hub_callback(p_cb_data data);
+} // namespace scheduler
+
+#endif // DUT_TOP_EDGEHUB_HPP
@@ -0,0 +1,279 @@
+// MIT License
+//
+// Copyright (c) 2024 Rovshan Rustamov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "readsync.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace scheduler {
+  namespace {
+    struct ReadBatch {
+      std::uint64_t target{}; // absolute tick the batch fires at
+
+      // Persistent VPI time storage; must remain valid while registered.
+      s_vpi_time time{};
+
+      // Kept so a batch emptied by cancels can take its callback back
+      vpiHandle cb{nullptr};
+
+      // Readers in suspension order
+      std::vector<std::coroutine_handle<>> waiters;
+
+      // Readers the callback is resuming, detached from 'waiters'
+      std::vector<std::coroutine_handle<>> ready;
+    };
+
+    // Batches are recycled rather than freed: a batch that fired or was
+    // emptied goes back on the free list with its vectors cleared but keeping
+    // their capacity, so steady-state reads allocate nothing. Batch addresses
+    // are stable and ride in the callback's user_data.
+    struct BatchStore {
+      std::vector<std::unique_ptr<ReadBatch>> owned;
+      std::vector<ReadBatch*> pending; // armed, a handful of ticks at most
+      std::vector<ReadBatch*> free;
+    };
+
+    BatchStore& batch_store() {
+      static BatchStore store;
+      return store;
+    }
+
+    ReadBatch* find_pending(const std::uint64_t target) {
+      for (ReadBatch* batch : batch_store().pending) {
+        if (batch->target == target) {
+          return batch;
+        }
+      }
+      return nullptr;
+    }
+
+    ReadBatch* acquire_batch() {
+      BatchStore& store = batch_store();
+      if (store.free.empty()) {
+        store.owned.push_back(std::make_unique<ReadBatch>());
+        return store.owned.back().get();
+      }
+      ReadBatch* batch = store.free.back();
+      store.free.pop_back();
+      return batch;
+    }
+
+    void unlink_pending(ReadBatch* batch) {
+      auto& pending = batch_store().pending;
+      pending.erase(std::find(pending.begin(), pending.end(), batch));
+    }
+
+    void release_batch(ReadBatch* batch) {
+      batch->waiters.clear();
+      batch->ready.clear();
+      batch->cb = nullptr;
+      batch_store().free.push_back(batch);
+    }
+
+    struct CachedValue {
+      std::uint64_t epoch{}; // batch the value was read in
+      std::vector<s_vpi_vecval> words;
+    };
+
+    std::unordered_map<vpiHandle, CachedValue>& value_cache() {
+      static std::unordered_map<vpiHandle, CachedValue> map;
+      return map;
+    }
+
+    ReadSyncStats sync_stats{};
+
+    // Non-zero only while a batch is resuming its readers
+    std::uint64_t active_epoch{0};
+    std::uint64_t epoch_counter{0};
+
+    std::uint64_t current_ticks() noexcept {
+      s_vpi_time time{};
+      time.type = vpiSimTime;
+      vpi_get_time(nullptr, &time);
+      return (static_cast<std::uint64_t>(time.high) << 32) | static_cast<std::uint64_t>(time.low);
+    }
+  } // namespace
+
+  bool read_sync_wait(const std::uint64_t delay_ticks, std::coroutine_handle<> h) {
+    const std::uint64_t target = current_ticks() + delay_ticks;
+    ReadBatch* batch = find_pending(target);
+
+    if (batch == nullptr) {
+      batch = acquire_batch();
+      batch->target = target;
+      batch->time.type = vpiSimTime;
+      batch->time.high = static_cast<PLI_UINT32>(delay_ticks >> 32);
+      batch->time.low = static_cast<PLI_UINT32>(delay_ticks & 0xffffffffULL);
+
+      s_cb_data cb_data{};
+      cb_data.reason = cbReadOnlySynch;
+      cb_data.cb_rtn = &read_sync_callback;
+      cb_data.time = &batch->time;
+      cb_data.user_data = reinterpret_cast<PLI_BYTE8*>(batch);
+
+      batch->cb = vpi_register_cb(&cb_data);
+      if (batch->cb == nullptr) {
+        release_batch(batch);
+        return false;
+      }
+      batch_store().pending.push_back(batch);
+      ++sync_stats.callbacks;
+    }
+
+    batch->waiters.push_back(h);
+    ++sync_stats.waits;
+    return true;
+  }
+
+  bool read_sync_cancel(std::coroutine_handle<> h) {
+    for (ReadBatch* batch : batch_store().pending) {
+      auto& waiters = batch->waiters;
+      const auto pos = std::find(waiters.begin(), waiters.end(), h);
+      if (pos == waiters.end()) {
+        continue;
+      }
+
+      waiters.erase(pos);
+      ++sync_stats.cancels;
+      if (waiters.empty()) {
+        // Nobody left to read at that tick
+        vpi_remove_cb(batch->cb);
+        unlink_pending(batch);
+        release_batch(batch);
+        ++sync_stats.removed;
+      }
+      return true;
+    }
+    return false;
+  }
+
+  const s_vpi_vecval* get_value_words(vpiHandle net, const PLI_INT32 format, const unsigned int width) {
+    // Scalar and int reads spare the simulator building a vecval array
+    static s_vpi_vecval narrow{};
+
+    s_vpi_value read_val{};
+    read_val.format = format;
+    vpi_get_value(net, &read_val);
+
+    switch (format) {
+    case vpiScalarVal: {
+      const PLI_INT32 scalar = read_val.value.scalar;
+      narrow.aval = (scalar == vpi1 || scalar == vpiH || scalar == vpiX) ? 1 : 0;
+      narrow.bval = (scalar == vpiX || scalar == vpiZ) ? 1 : 0;
+      return &narrow;
+    }
+    case vpiIntVal: {
+      // Signed nets come back sign-extended
+      auto value = static_cast<std::uint32_t>(read_val.value.integer);
+      if (width < 32) {
+        value &= (1u << width) - 1;
+      }
+      narrow.aval = static_cast<PLI_INT32>(value);
+      narrow.bval = 0;
+      return &narrow;
+    }
+    default:
+      return read_val.value.vector;
+    }
+  }
+
+  const s_vpi_vecval* read_sync_vector(vpiHandle net, const PLI_INT32 format, const unsigned int width) {
+    if (active_epoch == 0) {
+      ++sync_stats.cache_misses;
+      return get_value_words(net, format, width);
+    }
+
+    const unsigned int words = (width + 31) / 32;
+
+    CachedValue& cached = value_cache()[net];
+    if (cached.epoch == active_epoch && cached.words.size() >= words) {
+      ++sync_stats.cache_hits;
+      return cached.words.data();
+    }
+
+    // The simulator's vector buffer is only valid until the next
+    // vpi_get_value, so keep a copy for the rest of the batch.
+    const s_vpi_vecval* value = get_value_words(net, format, width);
+    ++sync_stats.cache_misses;
+
+    cached.words.assign(value, value + words);
+    cached.epoch = active_epoch;
+    return cached.words.data();
+  }
+
+  const ReadSyncStats& read_sync_stats() noexcept {
+    return sync_stats;
+  }
+
+  void print_read_sync_stats() {
+    std::printf("[INFO]\tRapidVPI read sync: waits=%llu callbacks=%llu cancels=%llu removed=%llu cache_hits=%llu cache_misses=%llu peak_batch=%zu\n",
+                static_cast<unsigned long long>(sync_stats.waits),
+                static_cast<unsigned long long>(sync_stats.callbacks),
+                static_cast<unsigned long long>(sync_stats.cancels),
+                static_cast<unsigned long long>(sync_stats.removed),
+                static_cast<unsigned long long>(sync_stats.cache_hits),
+                static_cast<unsigned long long>(sync_stats.cache_misses),
+                sync_stats.peak_batch);
+  }
+
+  // cbReadOnlySynch, one-shot -> resumes every AwaitRead due at this tick
+  PLI_INT32 read_sync_callback(p_cb_data data) {
+    auto* batch =
+      data
+        ? reinterpret_cast<ReadBatch*>(data->user_data)
+        : nullptr;
+
+    if (batch == nullptr || batch->cb == nullptr) {
+      return 0;
+    }
+
+    // Detach the batch first: a reader that awaits again for this tick
+    // starts a fresh batch with its own callback, as before coalescing.
+    // The batch is only recycled once its readers have been resumed.
+    std::vector<std::coroutine_handle<>>& ready = batch->ready;
+    ready.swap(batch->waiters);
+    vpi_free_object(batch->cb);
+    batch->cb = nullptr;
+    unlink_pending(batch);
+
+    sync_stats.peak_batch = std::max(sync_stats.peak_batch, ready.size());
+
+#ifdef RAPIDVPI_DEBUG
+    std::printf("[DBG] read_sync_callback: resuming %zu readers\n", ready.size());
+#endif
+
+    const std::uint64_t outer_epoch = active_epoch;
+    active_epoch = ++epoch_counter;
+    for (const std::coroutine_handle<> h : ready) {
+      h.resume();
+    }
+    active_epoch = outer_epoch;
+
+    release_batch(batch);
+    return 0;
+  }
+} // namespace scheduler
@@ -0,0 +1,73 @@
+// MIT License
+//
+// Copyright (c) 2024 Rovshan Rustamov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+// Description: Coalesced read-only synchronisation. Every AwaitRead targeting
+// the same tick shares one cbReadOnlySynch; while that batch is being resumed
+// the design is read-only, so vpi_get_value results are memoized per net and
+// reused by every reader in the batch.
+
+#ifndef DUT_TOP_READSYNC_HPP
+#define DUT_TOP_READSYNC_HPP
+
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+
+#include <vpi_user.h>
+
+namespace scheduler {
+  struct ReadSyncStats {
+    std::uint64_t waits{}; // AwaitRead suspensions
+    std::uint64_t callbacks{}; // cbReadOnlySynch registrations
+    std::uint64_t cancels{}; // readers withdrawn before their batch fired
+    std::uint64_t removed{}; // callbacks removed because every reader withdrew
+    std::uint64_t cache_hits{}; // vpi_get_value calls served from the step cache
+    std::uint64_t cache_misses{}; // vpi_get_value calls made
+    std::size_t peak_batch{}; // most readers resumed by one callback
+  };
+
+  // Resume 'h' in the read-only-synch region 'delay_ticks' from now, together
+  // with every other reader due at that tick. Returns false if the VPI
+  // callback could not be registered.
+  bool read_sync_wait(std::uint64_t delay_ticks, std::coroutine_handle<> h);
+
+  // Withdraw a reader queued by read_sync_wait(). Returns false if it is not
+  // queued any more. A batch left empty has its callback removed.
+  bool read_sync_cancel(std::coroutine_handle<> h);
+
+  // Value of the 'width'-bit 'net' read with 'format' (vpiScalarVal, vpiIntVal
+  // or vpiVectorVal) and returned as vecval words. vpiIntVal drops x/z bits.
+  // The returned pointer is valid until the next call.
+  const s_vpi_vecval* get_value_words(vpiHandle net, PLI_INT32 format, unsigned int width);
+
+  // get_value_words() for AwaitRead. Inside a read-only batch the value is
+  // fetched once per net and shared; elsewhere it is read directly.
+  const s_vpi_vecval* read_sync_vector(vpiHandle net, PLI_INT32 format, unsigned int width);
+
+  [[nodiscard]] const ReadSyncStats& read_sync_stats() noexcept;
+  void print_read_sync_stats();
+
+  PLI_INT32 read_sync_callback(p_cb_data data);
+} // namespace scheduler
+
+#endif // DUT_TOP_READSYNC_HPP
@@ -24,98 +24,37 @@
 #include <cstdint>
 
 namespace scheduler {
-  // cbAfterDelay -> used by AwaitWrite
-  PLI_INT32 write_callback(p_cb_data data) {
-#ifdef RAPIDVPI_DEBUG
-    std::printf("[DBG] write_callback entered: data=%p reason=%d obj=%p\n",
-                static_cast<void*>(data),
-                data ? data->reason : -1,
-                data ? static_cast<void*>(data->obj) : nullptr);
-#endif
-
-    auto* callbackData =
-      data
-        ? reinterpret_cast<SchedulerCallbackData*>(data->user_data)
-        : nullptr;
-
-#ifdef RAPIDVPI_DEBUG
-    std::printf("[DBG] write_callback: user_data=%p\n",
-                static_cast<void*>(callbackData));
-#endif
-
-    std::coroutine_handle<> h{};
-    if (callbackData) {
-      h = callbackData->handle;
-    }
-
-#ifdef RAPIDVPI_DEBUG
-    if (h) {
-      std::printf("[DBG] write_callback: resuming coroutine %p\n",
-                  static_cast<void*>(h.address()));
-    }
-    else {
-      std::printf("[DBG] write_callback: NULL handle or user_data\n");
-    }
-#endif
-    if (h) {
-      h.resume();
-    }
-
-    // cbAfterDelay is one-shot. Simulator will drop the callback;
-    // we only need to free our user_data now.
-    if (callbackData) {
-      delete callbackData;
-      data->user_data = nullptr;
-    }
-
-    return 0;
+  CallbackPool<ChangeCallbackData>& change_pool() {
+    static CallbackPool<ChangeCallbackData> pool;
+    return pool;
   }
 
-  // cbReadOnlySynch -> used by AwaitRead
-  PLI_INT32 read_callback(p_cb_data data) {
-#ifdef RAPIDVPI_DEBUG
-    std::printf("[DBG] read_callback entered: data=%p reason=%d obj=%p\n",
-                static_cast<void*>(data),
-                data ? data->reason : -1,
-                data ? static_cast<void*>(data->obj) : nullptr);
-#endif
-
-    auto* callbackData =
-      data
-        ? reinterpret_cast<SchedulerCallbackData*>(data->user_data)
-        : nullptr;
-
-#ifdef RAPIDVPI_DEBUG
-    std::printf("[DBG] read_callback: user_data=%p\n",
-                static_cast<void*>(callbackData));
-#endif
-
-    std::coroutine_handle<> h{};
-    if (callbackData) {
-      h = callbackData->handle;
-    }
-
-#ifdef RAPIDVPI_DEBUG
-    if (h) {
-      std::printf("[DBG] read_callback: resuming coroutine %p\n",
-                  static_cast<void*>(h.address()));
-    }
-    else {
-      std::printf("[DBG] read_callback: NULL handle or user_data\n");
-    }
-#endif
-    if (h) {
-      h.resume();
-    }
-
-    // cbReadOnlySynch is also one-shot; simulator removes callback.
-    // Free our user_data.
-    if (callbackData) {
-      delete callbackData;
-      data->user_data = nullptr;
+  namespace {
+    void print_pool_line(const char* name, const CallbackPoolStats& st) {
+      std::printf("[INFO]\tRapidVPI %s pool: live=%zu peak=%zu capacity=%zu slabs=%zu acquires=%llu\n",
+                  name, st.live, st.peak, st.capacity, st.slabs,
+                  static_cast<unsigned long long>(st.acquires));
+    }
+
+    // Compare the 'width' low bits of two vecval arrays, aval and bval alike
+    bool vecval_equal(const s_vpi_vecval* value, const s_vpi_vecval* target, const unsigned int width) {
+      const unsigned int words = (width + 31) / 32;
+      for (unsigned int i = 0; i < words; ++i) {
+        std::uint32_t diff = (static_cast<std::uint32_t>(value[i].aval) ^ static_cast<std::uint32_t>(target[i].aval)) |
+                             (static_cast<std::uint32_t>(value[i].bval) ^ static_cast<std::uint32_t>(target[i].bval));
+        if (i + 1 == words && width % 32 != 0) {
+          diff &= (1u << (width % 32)) - 1;
+        }
+        if (diff != 0) {
+          return false;
+        }
+      }
+      return true;
     }
+  } // namespace
 
-    return 0;
+  void print_pool_stats() {
+    print_pool_line("change", change_pool().stats());
   }
 
   // cbValueChange, non-targeted -> used by AwaitChange (any change)
@@ -129,7 +68,7 @@ namespace scheduler {
 
     auto* callbackData =
       data
-        ? reinterpret_cast<SchedulerCallbackData*>(data->user_data)
+        ? reinterpret_cast<ChangeCallbackData*>(data->user_data)
         : nullptr;
 
 #ifdef RAPIDVPI_DEBUG
@@ -140,6 +79,15 @@ namespace scheduler {
     std::coroutine_handle<> h{};
     if (callbackData) {
       h = callbackData->handle;
+
+      // Non-targeted cbValueChange: we only care about first change.
+      // Remove callback and recycle user_data so it cannot fire again.
+      if (callbackData->cb_handle) {
+        vpi_remove_cb(callbackData->cb_handle);
+        callbackData->cb_handle = nullptr;
+      }
+      change_pool().release(callbackData);
+      data->user_data = nullptr;
     }
 
 #ifdef RAPIDVPI_DEBUG
@@ -155,17 +103,6 @@ namespace scheduler {
       h.resume();
     }
 
-    // Non-targeted cbValueChange: we only care about first change.
-    // Remove callback and free user_data so it cannot fire again.
-    if (callbackData) {
-      if (callbackData->cb_handle) {
-        vpi_remove_cb(callbackData->cb_handle);
-        callbackData->cb_handle = nullptr;
-      }
-      delete callbackData;
-      data->user_data = nullptr;
-    }
-
     return 0;
   }
 
@@ -180,7 +117,7 @@ namespace scheduler {
 
     auto* callbackData =
       data
-        ? reinterpret_cast<SchedulerCallbackData*>(data->user_data)
+        ? reinterpret_cast<ChangeCallbackData*>(data->user_data)
         : nullptr;
 
 #ifdef RAPIDVPI_DEBUG
@@ -203,16 +140,24 @@ namespace scheduler {
 #endif
 
     // Read current value of the watched net
-    s_vpi_value read_val{};
-    read_val.format = vpiVectorVal;
-    vpi_get_value(data->obj, &read_val);
+    const PLI_INT32 format =
+      callbackData->cb_value_format != 0 ? callbackData->cb_value_format : vpiVectorVal;
+    const s_vpi_vecval* value = get_value_words(data->obj, format, net_length);
 
     bool match = false;
     unsigned long long cur_val = 0;
 
-    if (net_length <= 32) {
+    if (callbackData->cb_change_condition != nullptr) {
+      match = callbackData->cb_change_condition(callbackData->cb_change_condition_ctx,
+                                                value, net_length);
+    }
+    else if (const s_vpi_vecval* target = callbackData->cb_change_target_vecval; target != nullptr) {
+      // Four-state target: every aval and bval bit of the net must match
+      match = vecval_equal(value, target, net_length);
+    }
+    else if (net_length <= 32) {
       const auto aval0 =
-        static_cast<std::uint32_t>(read_val.value.vector[0].aval);
+        static_cast<std::uint32_t>(value[0].aval);
       cur_val = static_cast<unsigned long long>(aval0);
 
 #ifdef RAPIDVPI_DEBUG
@@ -220,15 +165,15 @@ namespace scheduler {
                   cur_val);
 #endif
 
-      if (callbackData->cb_change_target_value == cur_val) {
+      if (((callbackData->cb_change_target_value ^ cur_val) & callbackData->cb_change_target_mask) == 0) {
         match = true;
       }
     }
     else {
       const auto aval0 =
-        static_cast<std::uint32_t>(read_val.value.vector[0].aval);
+        static_cast<std::uint32_t>(value[0].aval);
       const auto aval1 =
-        static_cast<std::uint32_t>(read_val.value.vector[1].aval);
+        static_cast<std::uint32_t>(value[1].aval);
 
       std::uint64_t combined =
         (static_cast<std::uint64_t>(aval1) << 32) |
@@ -240,7 +185,7 @@ namespace scheduler {
                   cur_val);
 #endif
 
-      if (callbackData->cb_change_target_value == combined) {
+      if (((callbackData->cb_change_target_value ^ combined) & callbackData->cb_change_target_mask) == 0) {
         match = true;
       }
     }
@@ -260,12 +205,12 @@ namespace scheduler {
 
     std::coroutine_handle<> h = callbackData->handle;
 
-    // On match: remove callback and free user_data so it cannot fire again.
+    // On match: remove callback and recycle user_data so it cannot fire again.
     if (callbackData->cb_handle) {
       vpi_remove_cb(callbackData->cb_handle);
       callbackData->cb_handle = nullptr;
     }
-    delete callbackData;
+    change_pool().release(callbackData);
     data->user_data = nullptr;
 
     if (h) {
@@ -24,34 +24,54 @@
 #define DUT_TOP_SCHEDULER_HPP
 
 #include <coroutine>
-#include <vector>
 
 #include <vpi_user.h>
 
+#include "callbackpool.hpp"
+#include "edgehub.hpp"
+#include "timerwheel.hpp"
+#include "readsync.hpp"
+#include "writebuffer.hpp"
+#include "watchset.hpp"
+
 namespace scheduler {
-  struct SchedulerCallbackData {
+  // cbValueChange (AwaitChange), both any-change and targeted
+  struct ChangeCallbackData {
     // Coroutine to resume when callback fires
     std::coroutine_handle<> handle{};
 
+    // Registered callback handle so we can explicitly vpi_remove_cb() when done.
+    vpiHandle cb_handle{};
+
     // For targeted cbValueChange
     unsigned long long cb_change_target_value{}; // target value
     unsigned int cb_change_target_value_length{}; // bit-length of monitored signal
+    const s_vpi_vecval* cb_change_target_vecval{}; // four-state target words, or null
+    PLI_INT32 cb_value_format{}; // format to read the net with (0: vpiVectorVal)
+    unsigned long long cb_change_target_mask{}; // target bits compared (set by the awaiter)
 
-    // Persistent VPI time/value storage for this callback.
-    // These must remain valid while the callback is registered.
-    s_vpi_time time{}; // used for cb_data.time (cbAfterDelay, cbReadOnlySynch, cbValueChange)
-    s_vpi_value vpi_value{}; // used for cb_data.value (cbValueChange, etc.)
-
-    // Optional backing storage if you ever want vpiVectorVal with value.vector
-    std::vector<s_vpi_vecval> vec;
+    // Condition checked instead of the target when set; ctx lives in the
+    // suspended awaitable until the callback resumes it
+    bool (*cb_change_condition)(const void* ctx, const s_vpi_vecval* value, unsigned int length){};
+    const void* cb_change_condition_ctx{};
 
-    // For cbValueChange callbacks, remember the registered callback handle
-    // so we can explicitly vpi_remove_cb() when we are done.
-    vpiHandle cb_handle{}; // handle returned by vpi_register_cb
+    // Persistent VPI time/value storage; must remain valid while registered.
+    s_vpi_time time{};
+    s_vpi_value vpi_value{};
   };
 
-  PLI_INT32 write_callback(p_cb_data data);
-  PLI_INT32 read_callback(p_cb_data data);
+  CallbackPool<ChangeCallbackData>& change_pool();
+
+  // Acquire a value-initialized record from its pool. Ownership stays with the
+  // returned pointer until .release() hands it over to the VPI callback.
+  template <typename T>
+  PooledPtr<T> make_pooled(CallbackPool<T>& pool) {
+    return PooledPtr<T>{pool.acquire(), PoolDeleter<T>{&pool}};
+  }
+
+  // Prints live/peak/capacity occupancy of every callback pool.
+  void print_pool_stats();
+
   PLI_INT32 change_callback(p_cb_data data);
   PLI_INT32 change_callback_targeted(p_cb_data data);
 } // namespace scheduler
@@ -0,0 +1,307 @@
+// MIT License
+//
+// Copyright (c) 2024 Rovshan Rustamov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "timerwheel.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdio>
+#include <vector>
+
+namespace scheduler {
+  namespace {
+    // 11 levels of 64 slots cover the full 64-bit tick range. A timer sits on
+    // the level of the highest 6-bit digit in which its deadline differs from
+    // the wheel time, so lower levels always hold earlier deadlines and the
+    // earliest occupied slot of a level is its lowest set occupancy bit.
+    constexpr unsigned bits_per_level = 6;
+    constexpr unsigned slots_per_level = 1u << bits_per_level;
+    constexpr std::uint64_t slot_mask = slots_per_level - 1;
+    constexpr unsigned levels = (64 + bits_per_level - 1) / bits_per_level;
+
+    struct Timer {
+      std::uint64_t deadline;
+      std::uint64_t seq; // scheduling order, used to resume same-tick timers FIFO
+      std::coroutine_handle<> handle;
+    };
+
+    class TimerWheel {
+    public:
+      void insert(const std::uint64_t deadline, std::coroutine_handle<> h) {
+        place_(Timer{deadline, seq_++, h});
+      }
+
+      // Remove the timer of 'h'; false if the wheel does not hold it
+      bool erase(std::coroutine_handle<> h) {
+        for (unsigned level = 0; level < levels; ++level) {
+          for (std::uint64_t bits = occupied_[level]; bits != 0; bits &= bits - 1) {
+            const auto slot = static_cast<unsigned>(std::countr_zero(bits));
+            auto& bucket = slots_[level][slot];
+            const auto it = std::find_if(bucket.begin(), bucket.end(),
+                                         [h](const Timer& t) { return t.handle == h; });
+            if (it == bucket.end()) {
+              continue;
+            }
+
+            bucket.erase(it);
+            if (bucket.empty()) {
+              occupied_[level] &= ~(1ull << slot);
+            }
+            return true;
+          }
+        }
+        return false;
+      }
+
+      [[nodiscard]] bool empty() const noexcept {
+        return std::none_of(occupied_.begin(), occupied_.end(),
+                            [](const std::uint64_t bits) { return bits != 0; });
+      }
+
+      // Earliest pending deadline; only valid when !empty().
+      [[nodiscard]] std::uint64_t next_deadline() const noexcept {
+        for (unsigned level = 0; level < levels; ++level) {
+          if (occupied_[level] == 0) {
+            continue;
+          }
+
+          const auto slot = static_cast<unsigned>(std::countr_zero(occupied_[level]));
+          if (level == 0) {
+            return (now_ & ~slot_mask) | slot;
+          }
+
+          const auto& bucket = slots_[level][slot];
+          return std::min_element(bucket.begin(), bucket.end(),
+                                  [](const Timer& a, const Timer& b) { return a.deadline < b.deadline; })
+            ->deadline;
+        }
+        return now_;
+      }
+
+      // Move wheel time to 'tick' (the earliest deadline) and collect every
+      // timer due at it into 'due' in scheduling order.
+      void advance(const std::uint64_t tick, std::vector<Timer>& due) {
+        now_ = tick;
+
+        // Buckets that now share their digit with the wheel time cascade
+        // down; top-down so cascaded timers are picked up by lower levels.
+        for (unsigned level = levels; level-- > 1;) {
+          const unsigned slot = digit_(tick, level);
+          if ((occupied_[level] & (1ull << slot)) == 0) {
+            continue;
+          }
+
+          std::vector<Timer> bucket;
+          bucket.swap(slots_[level][slot]);
+          occupied_[level] &= ~(1ull << slot);
+
+          for (const Timer& t : bucket) {
+            if (t.deadline == tick) {
+              due.push_back(t);
+            }
+            else {
+              place_(t);
+            }
+          }
+        }
+
+        const unsigned slot = digit_(tick, 0);
+        if ((occupied_[0] & (1ull << slot)) != 0) {
+          auto& bucket = slots_[0][slot];
+          due.insert(due.end(), bucket.begin(), bucket.end());
+          bucket.clear();
+          occupied_[0] &= ~(1ull << slot);
+        }
+
+        std::sort(due.begin(), due.end(),
+                  [](const Timer& a, const Timer& b) { return a.seq < b.seq; });
+      }
+
+    private:
+      static unsigned digit_(const std::uint64_t tick, const unsigned level) noexcept {
+        return static_cast<unsigned>((tick >> (level * bits_per_level)) & slot_mask);
+      }
+
+      void place_(const Timer& t) {
+        const std::uint64_t diff = t.deadline ^ now_;
+        const unsigned level = diff == 0 ? 0 : (static_cast<unsigned>(std::bit_width(diff)) - 1) / bits_per_level;
+        const unsigned slot = digit_(t.deadline, level);
+
+        slots_[level][slot].push_back(t);
+        occupied_[level] |= 1ull << slot;
+      }
+
+      std::uint64_t now_{0};
+      std::uint64_t seq_{0};
+      std::array<std::uint64_t, levels> occupied_{};
+      std::array<std::array<std::vector<Timer>, slots_per_level>, levels> slots_{};
+    };
+
+    TimerWheel& wheel() {
+      static TimerWheel instance;
+      return instance;
+    }
+
+    TimerWheelStats wheel_stats{};
+
+    vpiHandle armed_cb{nullptr}; // the single outstanding cbAfterDelay
+    std::uint64_t armed_deadline{0};
+    bool firing{false}; // re-arm once after a firing pass, not per insert
+
+    std::uint64_t current_ticks() noexcept {
+      s_vpi_time time{};
+      time.type = vpiSimTime;
+      vpi_get_time(nullptr, &time);
+      return (static_cast<std::uint64_t>(time.high) << 32) | static_cast<std::uint64_t>(time.low);
+    }
+
+    bool arm(const std::uint64_t deadline, const std::uint64_t now) {
+      const std::uint64_t delay = deadline - now;
+
+      s_vpi_time time{};
+      time.type = vpiSimTime;
+      time.high = static_cast<PLI_UINT32>(delay >> 32);
+      time.low = static_cast<PLI_UINT32>(delay & 0xffffffffULL);
+
+      s_cb_data cb_data{};
+      cb_data.reason = cbAfterDelay;
+      cb_data.cb_rtn = &timer_wheel_callback;
+      cb_data.time = &time; // copied by the simulator at registration
+
+      armed_cb = vpi_register_cb(&cb_data);
+      if (armed_cb == nullptr) {
+        std::printf("[WARNING]\tCannot register VPI Callback. scheduler::timer wheel %s\n", __FUNCTION__);
+        return false;
+      }
+
+      armed_deadline = deadline;
+      ++wheel_stats.arms;
+      return true;
+    }
+  } // namespace
+
+  bool timer_wheel_schedule(const std::uint64_t delay_ticks, std::coroutine_handle<> h) {
+    const std::uint64_t now = current_ticks();
+    const std::uint64_t deadline = now + delay_ticks;
+
+    wheel().insert(deadline, h);
+    ++wheel_stats.timers;
+    if (++wheel_stats.pending > wheel_stats.peak_pending) {
+      wheel_stats.peak_pending = wheel_stats.pending;
+    }
+
+    if (firing || (armed_cb != nullptr && armed_deadline <= deadline)) {
+      return true;
+    }
+
+    // New earliest deadline: move the one armed callback forward
+    if (armed_cb != nullptr) {
+      vpi_remove_cb(armed_cb);
+      armed_cb = nullptr;
+      ++wheel_stats.rearms;
+    }
+    return arm(deadline, now);
+  }
+
+  bool timer_wheel_cancel(std::coroutine_handle<> h) {
+    if (!wheel().erase(h)) {
+      return false;
+    }
+
+    --wheel_stats.pending;
+    ++wheel_stats.cancels;
+
+    // A firing pass re-arms on its own once it is done
+    if (firing || armed_cb == nullptr) {
+      return true;
+    }
+
+    // Drop the armed callback if it no longer serves the earliest deadline,
+    // so a cancelled long timeout leaves nothing behind in the simulator
+    if (wheel().empty()) {
+      vpi_remove_cb(armed_cb);
+      armed_cb = nullptr;
+      ++wheel_stats.disarms;
+      return true;
+    }
+
+    const std::uint64_t next = wheel().next_deadline();
+    if (next > armed_deadline) {
+      vpi_remove_cb(armed_cb);
+      armed_cb = nullptr;
+      ++wheel_stats.rearms;
+      arm(next, current_ticks());
+    }
+    return true;
+  }
+
+  const TimerWheelStats& timer_wheel_stats() noexcept {
+    return wheel_stats;
+  }
+
+  void print_timer_wheel_stats() {
+    std::printf("[INFO]\tRapidVPI timer wheel: timers=%llu arms=%llu rearms=%llu disarms=%llu cancels=%llu saved=%llu pending=%zu peak_pending=%zu\n",
+                static_cast<unsigned long long>(wheel_stats.timers),
+                static_cast<unsigned long long>(wheel_stats.arms),
+                static_cast<unsigned long long>(wheel_stats.rearms),
+                static_cast<unsigned long long>(wheel_stats.disarms),
+                static_cast<unsigned long long>(wheel_stats.cancels),
+                static_cast<unsigned long long>(wheel_stats.saved()),
+                wheel_stats.pending,
+                wheel_stats.peak_pending);
+  }
+
+  // cbAfterDelay, one-shot -> the single armed timer wheel callback
+  PLI_INT32 timer_wheel_callback(p_cb_data data) {
+    const std::uint64_t tick = armed_deadline;
+    // A fired one-shot's handle is still ours to release
+    vpi_free_object(armed_cb);
+    armed_cb = nullptr;
+
+    // The simulator cannot re-enter this callback while we resume, so one
+    // reused list is enough. New timers go into the wheel, not this list.
+    static std::vector<Timer> due;
+    due.clear();
+    wheel().advance(tick, due);
+
+#ifdef RAPIDVPI_DEBUG
+    std::printf("[DBG] timer_wheel_callback: tick=%llu due=%zu\n",
+                static_cast<unsigned long long>(tick), due.size());
+#endif
+
+    wheel_stats.pending -= due.size();
+    wheel_stats.fired += due.size();
+
+    firing = true;
+    for (const Timer& t : due) {
+      t.handle.resume();
+    }
+    firing = false;
+
+    if (!wheel().empty()) {
+      arm(wheel().next_deadline(), tick);
+    }
+    return 0;
+  }
+} // namespace scheduler
@@ -0,0 +1,69 @@
+// MIT License
+//
+// Copyright (c) 2024 Rovshan Rustamov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+// Description: Hierarchical timer wheel for delayed AwaitWrite wakeups. All
+// pending deadlines share one cbAfterDelay armed for the earliest of them;
+// when it fires, every coroutine due at that tick is resumed in the order it
+// was scheduled and the callback is re-armed for the next deadline.
+
+#ifndef DUT_TOP_TIMERWHEEL_HPP
+#define DUT_TOP_TIMERWHEEL_HPP
+
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+
+#include <vpi_user.h>
+
+namespace scheduler {
+  struct TimerWheelStats {
+    std::uint64_t timers{}; // timers scheduled
+    std::uint64_t fired{}; // timers resumed
+    std::uint64_t arms{}; // cbAfterDelay registrations made by the wheel
+    std::uint64_t rearms{}; // armed callbacks moved to another deadline
+    std::uint64_t disarms{}; // armed callbacks removed as the wheel emptied by cancels
+    std::uint64_t cancels{}; // timers withdrawn before their deadline
+    std::size_t pending{}; // timers currently waiting
+    std::size_t peak_pending{}; // high-water mark of pending timers
+
+    // cbAfterDelay registrations avoided compared to one per timer
+    [[nodiscard]] std::uint64_t saved() const noexcept { return timers > arms ? timers - arms : 0; }
+  };
+
+  // Resume 'h' after 'delay_ticks' (> 0) simulator ticks. Returns false if
+  // the VPI callback could not be registered.
+  bool timer_wheel_schedule(std::uint64_t delay_ticks, std::coroutine_handle<> h);
+
+  // Withdraw a timer scheduled for 'h'. Returns false if it is not pending
+  // any more (it fired, possibly in the pass now resuming). If the armed
+  // callback was only there for withdrawn timers it is removed, or moved to
+  // the next deadline.
+  bool timer_wheel_cancel(std::coroutine_handle<> h);
+
+  [[nodiscard]] const TimerWheelStats& timer_wheel_stats() noexcept;
+  void print_timer_wheel_stats();
+
+  PLI_INT32 timer_wheel_callback(p_cb_data data);
+} // namespace scheduler
+
+#endif // DUT_TOP_TIMERWHEEL_HPP
@@ -0,0 +1,147 @@
+// MIT License
+//
+// Copyright (c) 2024 Rovshan Rustamov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "watchset.hpp"
+
+#include <cstdio>
+
+namespace scheduler {
+  namespace {
+    WatchStats stats{};
+  } // namespace
+
+  bool watch_arm(WatchSet& set, const std::span<const vpiHandle> nets) {
+    set.time.type = vpiSimTime;
+    set.vpi_value.format = vpiIntVal;
+
+    s_cb_data cb_data{};
+    cb_data.reason = cbValueChange;
+    cb_data.cb_rtn = &watch_change_callback;
+    cb_data.time = &set.time;
+    cb_data.value = &set.vpi_value;
+    cb_data.user_data = reinterpret_cast<PLI_BYTE8*>(&set);
+
+    set.change_cbs.clear();
+    for (vpiHandle net : nets) {
+      cb_data.obj = net;
+      vpiHandle cbH = vpi_register_cb(&cb_data);
+      if (cbH == nullptr) {
+        watch_disarm(set);
+        return false;
+      }
+      set.change_cbs.push_back(cbH);
+    }
+
+    ++stats.arms;
+    return true;
+  }
+
+  bool watch_disarm(WatchSet& set) {
+    if (set.change_cbs.empty()) {
+      return false;
+    }
+
+    for (vpiHandle cbH : set.change_cbs) {
+      vpi_remove_cb(cbH);
+    }
+    set.change_cbs.clear();
+
+    if (set.sync_cb != nullptr) {
+      vpi_remove_cb(set.sync_cb);
+      set.sync_cb = nullptr;
+    }
+    return true;
+  }
+
+  const WatchStats& watch_stats() noexcept {
+    return stats;
+  }
+
+  void print_watch_stats() {
+    std::printf("[INFO]\tRapidVPI watch sets: arms=%llu changes=%llu checks=%llu matches=%llu\n",
+                static_cast<unsigned long long>(stats.arms),
+                static_cast<unsigned long long>(stats.changes),
+                static_cast<unsigned long long>(stats.checks),
+                static_cast<unsigned long long>(stats.matches));
+  }
+
+  // cbValueChange, persistent -> defer the check to the end of the time step
+  PLI_INT32 watch_change_callback(p_cb_data data) {
+    auto* set =
+      data
+        ? reinterpret_cast<WatchSet*>(data->user_data)
+        : nullptr;
+
+    if (set == nullptr) {
+      return 0;
+    }
+
+    ++stats.changes;
+    if (set->sync_cb != nullptr) {
+      return 0; // already checking this time step
+    }
+
+    s_vpi_time time{};
+    time.type = vpiSimTime; // zero delay: read-only region of this step
+
+    s_cb_data cb_data{};
+    cb_data.reason = cbReadOnlySynch;
+    cb_data.cb_rtn = &watch_sync_callback;
+    cb_data.time = &time; // copied by the simulator at registration
+    cb_data.user_data = reinterpret_cast<PLI_BYTE8*>(set);
+
+    set->sync_cb = vpi_register_cb(&cb_data);
+    if (set->sync_cb == nullptr) {
+      std::printf("[WARNING]\tCannot register VPI Callback. scheduler::%s\n", __FUNCTION__);
+    }
+    return 0;
+  }
+
+  // cbReadOnlySynch, one-shot -> check settled values, resume on a match
+  PLI_INT32 watch_sync_callback(p_cb_data data) {
+    auto* set =
+      data
+        ? reinterpret_cast<WatchSet*>(data->user_data)
+        : nullptr;
+
+    if (set == nullptr) {
+      return 0;
+    }
+
+    // A fired one-shot's handle is still ours to release
+    vpi_free_object(set->sync_cb);
+    set->sync_cb = nullptr;
+    ++stats.checks;
+    if (!set->check(set->ctx)) {
+      return 0;
+    }
+
+    ++stats.matches;
+    std::coroutine_handle<> h = set->handle;
+    watch_disarm(*set);
+    if (h) {
+      h.resume(); // may destroy the set; nothing touches it afterwards
+    }
+    return 0;
+  }
+} // namespace scheduler
@@ -0,0 +1,78 @@
+// MIT License
+//
+// Copyright (c) 2024 Rovshan Rustamov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+
+// Description: Multi-net watch sets for AwaitWatch. Every watched net gets a
+// cbValueChange; a change only marks the set dirty and arms one
+// cbReadOnlySynch for the time step, where the condition is checked on
+// settled values. The waiter is resumed only when the condition holds.
+
+#ifndef DUT_TOP_WATCHSET_HPP
+#define DUT_TOP_WATCHSET_HPP
+
+#include <coroutine>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <vpi_user.h>
+
+namespace scheduler {
+  struct WatchSet {
+    // Coroutine to resume once 'check' accepts the nets' values
+    std::coroutine_handle<> handle{};
+    bool (*check)(void* ctx){};
+    void* ctx{};
+
+    // One cbValueChange per net and the pending read-only check, if any
+    std::vector<vpiHandle> change_cbs;
+    vpiHandle sync_cb{};
+
+    // Persistent VPI time/value storage; must remain valid while registered.
+    s_vpi_time time{};
+    s_vpi_value vpi_value{};
+  };
+
+  struct WatchStats {
+    std::uint64_t arms{}; // watch sets armed
+    std::uint64_t changes{}; // cbValueChange callbacks serviced
+    std::uint64_t checks{}; // read-only checks run
+    std::uint64_t matches{}; // waiters resumed
+  };
+
+  // Register a value-change callback on every net of 'set'. The set must stay
+  // in place until it is resumed or disarmed. Returns false (leaving nothing
+  // registered) if a VPI callback could not be registered.
+  bool watch_arm(WatchSet& set, std::span<const vpiHandle> nets);
+
+  // Remove every callback of an armed set. Returns false if it was not armed.
+  bool watch_disarm(WatchSet& set);
+
+  [[nodiscard]] const WatchStats& watch_stats() noexcept;
+  void print_watch_stats();
+
+  PLI_INT32 watch_change_callback(p_cb_data data);
+  PLI_INT32 watch_sync_callback(p_cb_data data);
+} // namespace scheduler
+
+#endif // DUT_TOP_WATCHSET_HPP
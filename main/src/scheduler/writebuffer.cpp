@@ -0,0 +1,212 @@
+// MIT License
+//
+// Copyright (c) 2024 Rovshan Rustamov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "writebuffer.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+namespace scheduler {
+  namespace {
+    struct StagedPut {
+      vpiHandle net;
+      PLI_INT32 flag;
+      std::size_t offset; // first chunk in WriteBatch::words
+      unsigned int words;
+      std::uint64_t delay; // ticks after the flush; 0 applies it now
+    };
+
+    struct WriteBatch {
+      std::vector<StagedPut> puts;
+      std::vector<s_vpi_vecval> words;
+      std::vector<std::coroutine_handle<>> writers;
+
+      void clear() {
+        puts.clear();
+        words.clear();
+        writers.clear();
+      }
+    };
+
+    // How far back a plain write looks for an earlier plain write to the same
+    // net. Combining only saves puts, since the batch is applied in order.
+    constexpr std::size_t combine_window = 64;
+
+    // Staging and flushing batches are swapped on every flush so both keep
+    // their capacity; writes issued by resumed writers start a new step batch.
+    WriteBatch batches[2];
+    WriteBatch* staging = &batches[0];
+    WriteBatch* flushing = &batches[1];
+
+    bool armed{false};
+    WriteBufferStats buffer_stats{};
+
+    // Register the step's cbAfterDelay(0) unless it is already pending
+    bool arm() {
+      if (armed) {
+        return true;
+      }
+
+      s_vpi_time time{};
+      time.type = vpiSimTime; // zero delay: later in this time step
+
+      s_cb_data cb_data{};
+      cb_data.reason = cbAfterDelay;
+      cb_data.cb_rtn = &write_buffer_callback;
+      cb_data.time = &time; // copied by the simulator at registration
+
+      vpiHandle cbH = vpi_register_cb(&cb_data);
+      if (cbH == nullptr) {
+        return false;
+      }
+      vpi_free_object(cbH);
+
+      armed = true;
+      ++buffer_stats.flushes;
+      return true;
+    }
+
+    s_vpi_vecval* append(WriteBatch& batch, vpiHandle net, const PLI_INT32 flag,
+                         const unsigned int words, const std::uint64_t delay) {
+      const std::size_t offset = batch.words.size();
+      batch.words.resize(offset + words, s_vpi_vecval{0, 0});
+      batch.puts.push_back(StagedPut{net, flag, offset, words, delay});
+
+      return batch.words.data() + offset;
+    }
+  } // namespace
+
+  s_vpi_vecval* write_buffer_stage(vpiHandle net, const PLI_INT32 flag, const unsigned int words) {
+    WriteBatch& batch = *staging;
+
+    if (flag == vpiNoDelay) {
+      // Replace the net's latest put if it is a plain write; a force/release
+      // in between keeps its place in the sequence
+      const std::size_t first = batch.puts.size() > combine_window
+                                  ? batch.puts.size() - combine_window
+                                  : 0;
+      for (std::size_t i = batch.puts.size(); i > first; --i) {
+        const StagedPut& put = batch.puts[i - 1];
+        if (put.net != net) {
+          continue;
+        }
+        if (put.flag == vpiNoDelay && put.words == words) {
+          s_vpi_vecval* storage = batch.words.data() + put.offset;
+          std::fill(storage, storage + put.words, s_vpi_vecval{0, 0});
+          ++buffer_stats.combined;
+          return storage;
+        }
+        break;
+      }
+    }
+
+    return append(batch, net, flag, words, 0);
+  }
+
+  s_vpi_vecval* write_buffer_stage_delayed(vpiHandle net, const std::uint64_t delay,
+                                           const PLI_INT32 flag, const unsigned int words) {
+    if (!arm()) {
+      std::printf("[WARNING]\tCannot register VPI Callback for delayed writes. scheduler:: %s\n",
+                  __FUNCTION__);
+    }
+    if (delay == 0) {
+      return write_buffer_stage(net, vpiNoDelay, words);
+    }
+    return append(*staging, net, flag, words, delay);
+  }
+
+  bool write_buffer_wait(std::coroutine_handle<> h) {
+    if (!arm()) {
+      return false;
+    }
+
+    staging->writers.push_back(h);
+    ++buffer_stats.writers;
+    return true;
+  }
+
+  bool write_buffer_cancel(std::coroutine_handle<> h) {
+    auto& writers = staging->writers;
+    const auto pos = std::find(writers.begin(), writers.end(), h);
+    if (pos == writers.end()) {
+      return false;
+    }
+    writers.erase(pos);
+    return true;
+  }
+
+  const WriteBufferStats& write_buffer_stats() noexcept {
+    return buffer_stats;
+  }
+
+  void print_write_buffer_stats() {
+    std::printf("[INFO]\tRapidVPI write buffer: writers=%llu flushes=%llu puts=%llu combined=%llu delayed=%llu peak_puts=%zu\n",
+                static_cast<unsigned long long>(buffer_stats.writers),
+                static_cast<unsigned long long>(buffer_stats.flushes),
+                static_cast<unsigned long long>(buffer_stats.puts),
+                static_cast<unsigned long long>(buffer_stats.combined),
+                static_cast<unsigned long long>(buffer_stats.delayed),
+                buffer_stats.peak_puts);
+  }
+
+  // cbAfterDelay(0), one-shot -> applies the step's writes, then resumes writers
+  PLI_INT32 write_buffer_callback(p_cb_data data) {
+    std::swap(staging, flushing);
+    armed = false;
+
+    WriteBatch& batch = *flushing;
+
+#ifdef RAPIDVPI_DEBUG
+    std::printf("[DBG] write_buffer_callback: puts=%zu writers=%zu\n",
+                batch.puts.size(), batch.writers.size());
+#endif
+
+    s_vpi_value val{};
+    val.format = vpiVectorVal;
+    s_vpi_time time{};
+    time.type = vpiSimTime;
+    for (const StagedPut& put : batch.puts) {
+      val.value.vector = batch.words.data() + put.offset;
+      if (put.delay == 0) {
+        vpi_put_value(put.net, &val, nullptr, put.flag);
+        continue;
+      }
+
+      time.high = static_cast<PLI_UINT32>(put.delay >> 32u);
+      time.low = static_cast<PLI_UINT32>(put.delay & 0xffffffffULL);
+      vpi_put_value(put.net, &val, &time, put.flag);
+      ++buffer_stats.delayed;
+    }
+
+    buffer_stats.puts += batch.puts.size();
+    buffer_stats.peak_puts = std::max(buffer_stats.peak_puts, batch.puts.size());
+
+    for (const std::coroutine_handle<> h : batch.writers) {
+      h.resume();
+    }
+
+    batch.clear();
+    return 0;
+  }
+} // namespace scheduler
@@ -0,0 +1,76 @@
+// MIT License
+//
+// Copyright (c) 2024 Rovshan Rustamov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+// Description: Write-combining buffer for zero-delay AwaitWrite. Values are
+// packed when the writer suspends; one cbAfterDelay(0) per time step then
+// issues every buffered vpi_put_value in a single loop and resumes the
+// writers in suspension order. A later plain write to a net replaces the
+// earlier one in place (last writer wins). Puts staged with a delay are issued
+// from the same flush with a VPI delay, so the simulator applies them later.
+
+#ifndef DUT_TOP_WRITEBUFFER_HPP
+#define DUT_TOP_WRITEBUFFER_HPP
+
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+
+#include <vpi_user.h>
+
+namespace scheduler {
+  struct WriteBufferStats {
+    std::uint64_t writers{}; // AwaitWrite suspensions served
+    std::uint64_t flushes{}; // cbAfterDelay(0) registrations
+    std::uint64_t puts{}; // vpi_put_value calls issued
+    std::uint64_t combined{}; // writes replaced by a later writer before the flush
+    std::uint64_t delayed{}; // puts issued with a VPI delay (waveforms)
+    std::size_t peak_puts{}; // most puts issued by one flush
+  };
+
+  // Stage a put of 'words' 32-bit chunks to 'net' with 'flag' (vpiNoDelay,
+  // vpiForceFlag or vpiReleaseFlag). Returns zeroed storage to pack the value
+  // into; it is only valid until the next call.
+  s_vpi_vecval* write_buffer_stage(vpiHandle net, PLI_INT32 flag, unsigned int words);
+
+  // Stage a put which the simulator applies 'delay' ticks after the flush, with
+  // 'flag' vpiTransportDelay, vpiPureTransportDelay or vpiInertialDelay. The
+  // flush is armed without a waiter; a zero delay stages a plain write. Storage
+  // rules are as for write_buffer_stage.
+  s_vpi_vecval* write_buffer_stage_delayed(vpiHandle net, std::uint64_t delay,
+                                           PLI_INT32 flag, unsigned int words);
+
+  // Suspend 'h' until the staged writes of this time step are applied.
+  // Returns false if the VPI callback could not be registered.
+  bool write_buffer_wait(std::coroutine_handle<> h);
+
+  // Withdraw a writer queued by write_buffer_wait(). Its staged puts stay in
+  // the batch; only the resume is dropped. Returns false if it is not queued.
+  bool write_buffer_cancel(std::coroutine_handle<> h);
+
+  [[nodiscard]] const WriteBufferStats& write_buffer_stats() noexcept;
+  void print_write_buffer_stats();
+
+  PLI_INT32 write_buffer_callback(p_cb_data data);
+} // namespace scheduler
+
+#endif // DUT_TOP_WRITEBUFFER_HPP
@@ -21,23 +21,50 @@
 // SOFTWARE.
 
 #include "testbase.hpp"
+#include <cstdint>
 #include <cstdio>
 
 namespace test {
+  namespace {
+    unsigned long long int low_u64(const s_vpi_vecval* value, const unsigned int length) {
+      unsigned long long int result = static_cast<std::uint32_t>(value[0].aval);
+      if (length > 32) {
+        result |= static_cast<unsigned long long int>(static_cast<std::uint32_t>(value[1].aval)) << 32;
+      }
+      return result;
+    }
+
+    // scheduler::ChangeCallbackData::cb_change_condition for predicate waits
+    bool predicate_condition(const void* ctx, const s_vpi_vecval* value, const unsigned int length) {
+      return (*static_cast<const ChangePredicate*>(ctx))(low_u64(value, length));
+    }
+  } // namespace
+
+  bool TestBase::AwaitChange::await_ready() const noexcept {
+    if (!change_check_ready || net.handle() == nullptr) {
+      return false;
+    }
+
+    const unsigned int net_length = net.length();
+    const s_vpi_vecval* value = scheduler::get_value_words(net.handle(), net.format(), net_length);
+    const unsigned long long int current = low_u64(value, net_length);
+    if (change_predicate) {
+      return change_predicate(current);
+    }
+    return ((current ^ change_target_value) & change_target_mask) == 0;
+  }
+
   void TestBase::AwaitChange::await_suspend(std::coroutine_handle<> h) {
     handle = h;
 
 #ifdef RAPIDVPI_DEBUG
     std::printf("[DBG] AwaitChange::await_suspend enter, net='%s', targeted=%d, handle=%p\n",
-                net.c_str(),
+                net.name(),
                 static_cast<int>(change_is_targeted),
                 static_cast<void*>(handle.address()));
 #endif
 
-    auto callbackData = std::make_unique<scheduler::SchedulerCallbackData>();
-    callbackData->handle = h;
-
-    vpiHandle net_handle = parent.getNetHandle(net);
+    vpiHandle net_handle = net.handle();
 #ifdef RAPIDVPI_DEBUG
     std::printf("[DBG] AwaitChange::await_suspend net_handle=%p\n",
                 static_cast<void*>(net_handle));
@@ -46,9 +73,31 @@ namespace test {
     if (net_handle == nullptr) {
       std::printf("[ERROR]\tAwaitChange::await_suspend: net '%s' has NULL handle, "
                   "cannot register cbValueChange.\n",
-                  net.c_str());
+                  net.name());
       return;
     }
+
+    // Single-bit nets (clocks, resets, serial lines) wait on the shared
+    // per-net edge hub instead of registering a cbValueChange of their own.
+    // Four-state targets need the exact compare of change_callback_targeted.
+    // A mask keeping bit 0 leaves a plain edge; predicates need the callback.
+    const unsigned long long int edge_target = change_target_value & change_target_mask;
+    if (net.length() == 1 && change_target_bits.width() == 0 && !change_predicate &&
+        (!change_is_targeted || (edge_target <= 1 && (change_target_mask & 1ULL) != 0))) {
+      const int edge = change_is_targeted
+                         ? static_cast<int>(edge_target)
+                         : scheduler::anyedge;
+#ifdef RAPIDVPI_DEBUG
+      std::printf("[DBG] AwaitChange::await_suspend: edge hub wait, edge=%d\n", edge);
+#endif
+      scheduler::edge_hub_wait(net_handle, edge, h);
+      cb_handle = nullptr;
+      hub_edge = edge;
+      return;
+    }
+
+    auto callbackData = scheduler::make_pooled(scheduler::change_pool());
+    callbackData->handle = h;
     // ---- Persistent time + value storage for Questa (MUST be non-null) ----
     detail::set_vpi_time_from_ticks(callbackData->time, 0);
 
@@ -64,12 +113,25 @@ namespace test {
 
     if (change_is_targeted) {
       callbackData->cb_change_target_value = change_target_value;
-      callbackData->cb_change_target_value_length = parent.getNetLength(net);
+      callbackData->cb_change_target_value_length = net.length();
+      callbackData->cb_value_format = net.format();
+      callbackData->cb_change_target_mask = change_target_mask;
+      if (change_predicate) {
+        callbackData->cb_change_condition = &predicate_condition;
+        callbackData->cb_change_condition_ctx = &change_predicate;
+      }
+      else if (change_target_bits.width() != 0) {
+        // Lives in the suspended awaitable until the callback resumes it
+        callbackData->cb_change_target_vecval = change_target_bits.data();
+        if (callbackData->cb_value_format == vpiIntVal) {
+          callbackData->cb_value_format = vpiVectorVal; // keep x/z for the compare
+        }
+      }
       cb_data.cb_rtn = &scheduler::change_callback_targeted;
 #ifdef RAPIDVPI_DEBUG
       std::printf("[DBG] AwaitChange::await_suspend: targeted change, target=%llu len=%u\n",
                   static_cast<unsigned long long>(change_target_value),
-                  parent.getNetLength(net));
+                  net.length());
 #endif
     }
     else {
@@ -87,7 +149,7 @@ namespace test {
     vpiHandle cbH = vpi_register_cb(&cb_data);
     if (cbH == nullptr) {
       std::printf("[WARNING]\tCannot register VPI Callback. TestBase::AwaitChange:: %s for net '%s'\n",
-                  __FUNCTION__, net.c_str());
+                  __FUNCTION__, net.name());
 
       s_vpi_error_info err{};
       if (vpi_chk_error(&err)) {
@@ -102,7 +164,7 @@ namespace test {
       }
 
       cb_handle = nullptr;
-      return; // unique_ptr auto-frees callbackData
+      return; // pooled pointer returns callbackData to its pool
     }
 
 #ifdef RAPIDVPI_DEBUG
@@ -111,14 +173,14 @@ namespace test {
 #endif
 
     callbackData->cb_handle = cbH;
-    (void)callbackData.release(); // hand off lifetime to the callback
+    cb_record = callbackData.release(); // hand off lifetime to the callback
     cb_handle = cbH;
   }
 
 
   void TestBase::AwaitChange::await_resume() noexcept {
 #ifdef RAPIDVPI_DEBUG
-    std::printf("[DBG] AwaitChange::await_resume enter, net='%s'\n", net.c_str());
+    std::printf("[DBG] AwaitChange::await_resume enter, net='%s'\n", net.name());
 #endif
 
     resume_time_ticks = detail::current_vpi_time_ticks();
@@ -129,62 +191,57 @@ namespace test {
 #endif
 
     // Read the value being changed
-    s_vpi_value read_val{};
-    read_val.format = vpiVectorVal;
-    vpi_get_value(parent.getNetHandle(net), &read_val);
-    const unsigned short int net_length = parent.getNetLength(net);
+    const unsigned int net_length = net.length();
+    const s_vpi_vecval* vector = scheduler::get_value_words(net.handle(), net.format(), net_length);
 
 #ifdef RAPIDVPI_DEBUG
     std::printf("[DBG] AwaitChange::await_resume: net_length=%u\n",
                 static_cast<unsigned int>(net_length));
 #endif
 
-    // Clear the previous change value
-    rd_change_value.strValue.clear();
-    rd_change_value.uintValues.clear();
-
     const unsigned int vecval_len =
       (static_cast<unsigned int>(net_length) + 31) / 32; // number of 32-bit chunks required
 
-    std::string final_strValue;
-    final_strValue.reserve(vecval_len * 32);
+    // Replace the previous change value
+    rd_change_value.vecval.assign(vector, vector + vecval_len);
 
     // numeric values: push in natural order (LS chunk to MS chunk)
+    rd_change_value.uintValues.clear();
     for (unsigned int i = 0; i < vecval_len; ++i) {
-      rd_change_value.uintValues.push_back(
-        static_cast<unsigned int>(read_val.value.vector[i].aval));
-    }
-
-    // string value: process from MS chunk down to LS chunk
-    for (int i = static_cast<int>(vecval_len) - 1; i >= 0; --i) {
-      const unsigned int avalue = read_val.value.vector[i].aval;
-      const unsigned int bvalue = read_val.value.vector[i].bval;
-
-      for (int j = 31; j >= 0; --j) {
-        char bit_representation;
-        const bool a_bit = (avalue & (1u << j)) != 0;
-        const bool b_bit = (bvalue & (1u << j)) != 0;
-
-        if (b_bit) {
-          bit_representation = a_bit ? 'x' : 'z';
-        }
-        else {
-          bit_representation = a_bit ? '1' : '0';
-        }
-        final_strValue.push_back(bit_representation);
-      }
+      rd_change_value.uintValues.push_back(static_cast<unsigned int>(vector[i].aval));
     }
 
-    rd_change_value.strValue = std::move(final_strValue);
+    // The binary string is built from vecval by the first getBinStr
+    rd_change_value.strValue.clear();
 
 #ifdef RAPIDVPI_DEBUG
-    std::printf("[DBG] AwaitChange::await_resume: strValue length=%zu\n",
-                rd_change_value.strValue.size());
+    std::printf("[DBG] AwaitChange::await_resume: vecval words=%u\n", vecval_len);
 #endif
 
     // scheduler::change_callback(_targeted) already removed the cb
-    // and deleted user_data on the firing edge.
+    // and recycled user_data on the firing edge.
     cb_handle = nullptr;
+    cb_record = nullptr;
+    hub_edge = -1;
+  }
+
+  bool TestBase::AwaitChange::cancel() noexcept {
+    if (hub_edge >= 0) {
+      const bool cancelled = scheduler::edge_hub_cancel(net.handle(), hub_edge, handle);
+      hub_edge = -1;
+      return cancelled;
+    }
+
+    if (cb_record == nullptr) {
+      return false;
+    }
+
+    // Not fired yet: a matching callback recycles the record and resumes at once
+    vpi_remove_cb(cb_handle);
+    scheduler::change_pool().release(cb_record);
+    cb_record = nullptr;
+    cb_handle = nullptr;
+    return true;
   }
 
   unsigned long long int TestBase::AwaitChange::getNum() {
@@ -212,16 +269,24 @@ namespace test {
   std::string TestBase::AwaitChange::getStr(const unsigned int base) {
     constexpr char EMPTY_STRING[] = "";
 
-    if (!rd_change_value.strValue.empty()) {
+    if (!rd_change_value.vecval.empty()) {
       if (base == 16) {
-        return bin_to_hex(rd_change_value.strValue);
+        return detail::vecval_to_hex(rd_change_value.vecval.data(),
+                                     static_cast<unsigned int>(rd_change_value.vecval.size()));
       }
-      return rd_change_value.strValue;
+      return detail::bin_str(rd_change_value);
     }
 
     return EMPTY_STRING;
   }
 
+  BitVector TestBase::AwaitChange::getBits() {
+    if (rd_change_value.vecval.empty()) {
+      return BitVector();
+    }
+    return BitVector(rd_change_value.vecval.data(), net.length());
+  }
+
   std::string TestBase::AwaitChange::getBinStr() {
     return getStr(2);
   }
@@ -0,0 +1,332 @@
+// MIT License
+//
+// Copyright (c) 2024 Rovshan Rustamov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+
+// Description: whenAny/whenAll combinators and withTimeout. Each awaitable of
+// a group is awaited by a small branch coroutine; the awaiting coroutine
+// resumes once enough branches have completed. Branches still waiting then
+// have their scheduler registration withdrawn through the awaitable's
+// cancel(), so a losing change, read or delay costs nothing further.
+
+#ifndef DUT_TOP_AWAITGROUP_HPP
+#define DUT_TOP_AWAITGROUP_HPP
+
+#include <array>
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <optional>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "framearena.hpp"
+
+namespace test {
+  // Awaitables a group can wait on: cancel() withdraws a pending wait and
+  // returns false if the scheduler already let go of it
+  template <typename A>
+  concept CancellableAwaitable = requires(A& a, std::coroutine_handle<> h) {
+    { a.await_ready() } -> std::convertible_to<bool>;
+    a.await_suspend(h);
+    a.await_resume();
+    { a.cancel() } -> std::same_as<bool>;
+  };
+
+  namespace detail {
+    inline constexpr std::size_t no_branch = std::numeric_limits<std::size_t>::max();
+
+    // State shared by the branches of one group. It lives in the awaiting
+    // coroutine's frame, which stays suspended until every started branch
+    // has finished or been cancelled.
+    struct AwaitGroupState {
+      struct Branch {
+        std::coroutine_handle<> handle{}; // null once finished or cancelled
+        void* awaitable{};
+        bool (*cancel)(void* awaitable){};
+      };
+
+      std::span<Branch> branches;
+      std::coroutine_handle<> parent{};
+      std::size_t needed{}; // completions that finish the group
+      std::size_t completed{};
+      std::size_t running{}; // started branches not yet finished
+      std::size_t first{no_branch}; // index of the first branch to complete
+      bool done{false};
+      bool launching{false};
+
+      // Called by branch 'index' once its awaitable resumed it. Finishing the
+      // group withdraws every branch still waiting; a branch the scheduler
+      // is already resuming in this pass sees 'done' and ends quietly.
+      void complete(const std::size_t index) {
+        if (first == no_branch) {
+          first = index;
+        }
+        if (++completed < needed) {
+          return;
+        }
+
+        done = true;
+        for (std::size_t i = 0; i < branches.size(); ++i) {
+          Branch& branch = branches[i];
+          if (i == index || !branch.handle) {
+            continue;
+          }
+          if (branch.cancel(branch.awaitable)) {
+            branch.handle.destroy();
+            branch.handle = nullptr;
+            --running;
+          }
+        }
+      }
+
+      // Called from a branch's final suspend; returns who runs next
+      std::coroutine_handle<> finished(const std::size_t index) noexcept {
+        branches[index].handle = nullptr;
+        --running;
+        if (running == 0 && done && !launching) {
+          return parent;
+        }
+        return std::noop_coroutine();
+      }
+    };
+
+    struct GroupBranch {
+      struct promise_type {
+        using Handle = std::coroutine_handle<promise_type>;
+
+        AwaitGroupState* group;
+        std::size_t index;
+
+        template <typename... Args>
+        promise_type(AwaitGroupState& group, const std::size_t index, Args&&...)
+          : group(&group)
+            , index(index) {
+        }
+
+        static void* operator new(std::size_t size) {
+          return frame_arena::allocate(size);
+        }
+
+        static void operator delete(void* ptr, std::size_t size) noexcept {
+          frame_arena::deallocate(ptr, size);
+        }
+
+        GroupBranch get_return_object() {
+          return GroupBranch{Handle::from_promise(*this)};
+        }
+
+        // Started by the group once its slot is filled in
+        std::suspend_always initial_suspend() noexcept {
+          return {};
+        }
+
+        // Free the frame, then hand control to the group's parent if this
+        // was the last branch it was waiting for
+        auto final_suspend() noexcept {
+          struct FinalAwaiter {
+            bool await_ready() const noexcept { return false; }
+
+            std::coroutine_handle<> await_suspend(Handle h) noexcept {
+              AwaitGroupState* group = h.promise().group;
+              const std::size_t index = h.promise().index;
+              h.destroy();
+              return group->finished(index);
+            }
+
+            void await_resume() noexcept {
+            }
+          };
+          return FinalAwaiter{};
+        }
+
+        void return_void() {
+        }
+
+        void unhandled_exception() { std::terminate(); }
+      };
+
+      using Handle = std::coroutine_handle<promise_type>;
+      Handle handle;
+    };
+
+    // Forwards to the branch's awaitable; a branch resumed after the group
+    // finished skips await_resume, so e.g. a losing delayed write puts nothing
+    template <typename A>
+    struct GroupForward {
+      AwaitGroupState& group;
+      std::size_t index;
+      A& awaitable;
+
+      bool await_ready() {
+        return awaitable.await_ready();
+      }
+
+      decltype(auto) await_suspend(std::coroutine_handle<> h) {
+        return awaitable.await_suspend(h);
+      }
+
+      void await_resume() {
+        if (group.done) {
+          return;
+        }
+        awaitable.await_resume();
+        group.complete(index);
+      }
+    };
+
+    template <typename A>
+    GroupBranch run_group_branch(AwaitGroupState& group, const std::size_t index, A& awaitable) {
+      co_await GroupForward<A>{group, index, awaitable};
+    }
+
+    template <typename A>
+    bool cancel_awaitable(void* awaitable) {
+      return static_cast<A*>(awaitable)->cancel();
+    }
+  } // namespace detail
+
+  // Returned by TestBase::whenAny/whenAll. Awaitables are held by reference
+  // and must outlive the co_await; read their values afterwards as usual.
+  // co_await yields the index of the first awaitable to complete, or
+  // nullopt if the group was cancelled before any of them did.
+  template <CancellableAwaitable... Awaitables>
+  class AwaitGroup {
+    static_assert(sizeof...(Awaitables) > 0, "AwaitGroup needs at least one awaitable");
+
+  public:
+    AwaitGroup(const std::size_t needed, Awaitables&... awaitables)
+      : awaitables(awaitables...) {
+      state.needed = needed;
+    }
+
+    bool await_ready() const noexcept { return false; }
+
+    bool await_suspend(std::coroutine_handle<> h) {
+      state.branches = branches;
+      state.parent = h;
+
+      // Branches may complete while they start (a change already matching);
+      // the parent is then not suspended at all
+      state.launching = true;
+      launch_(std::index_sequence_for<Awaitables...>{});
+      state.launching = false;
+      return !(state.done && state.running == 0);
+    }
+
+    std::optional<std::size_t> await_resume() const noexcept {
+      if (state.first == detail::no_branch) {
+        return std::nullopt;
+      }
+      return state.first;
+    }
+
+    // Withdraw every branch still waiting. False if one is already being
+    // resumed; it then ends quietly and the awaiting coroutine resumes.
+    bool cancel() noexcept {
+      if (state.done) {
+        return false;
+      }
+
+      state.done = true;
+      for (auto& branch : branches) {
+        if (branch.handle && branch.cancel(branch.awaitable)) {
+          branch.handle.destroy();
+          branch.handle = nullptr;
+          --state.running;
+        }
+      }
+      return state.running == 0;
+    }
+
+  private:
+    template <std::size_t... I>
+    void launch_(std::index_sequence<I...>) {
+      (launch_one_<I>(), ...);
+    }
+
+    template <std::size_t I>
+    void launch_one_() {
+      if (state.done) {
+        return;
+      }
+
+      using A = std::tuple_element_t<I, std::tuple<Awaitables...>>;
+      A& awaitable = std::get<I>(awaitables);
+      const auto branch = detail::run_group_branch(state, I, awaitable);
+
+      branches[I] = detail::AwaitGroupState::Branch{branch.handle, &awaitable, &detail::cancel_awaitable<A>};
+      ++state.running;
+      branch.handle.resume();
+    }
+
+    std::tuple<Awaitables&...> awaitables;
+    detail::AwaitGroupState state;
+    std::array<detail::AwaitGroupState::Branch, sizeof...(Awaitables)> branches{};
+  };
+
+  enum class TimeoutResult { fired, timed_out };
+
+  // Returned by TestBase::withTimeout: a group of the awaitable and one
+  // deadline, whichever completes first cancels the other. An lvalue
+  // awaitable is held by reference so its values can be read afterwards;
+  // a temporary is moved in. Not movable, as the group points at members.
+  template <typename A, CancellableAwaitable Deadline>
+    requires CancellableAwaitable<std::remove_reference_t<A>>
+  class AwaitTimeout {
+  public:
+    AwaitTimeout(A&& awaitable, Deadline deadline)
+      : awaitable(std::forward<A>(awaitable))
+        , deadline(std::move(deadline))
+        , group(1, this->awaitable, this->deadline) {
+    }
+
+    AwaitTimeout(const AwaitTimeout&) = delete;
+    AwaitTimeout& operator=(const AwaitTimeout&) = delete;
+
+    bool await_ready() const noexcept { return false; }
+
+    bool await_suspend(std::coroutine_handle<> h) {
+      return group.await_suspend(h);
+    }
+
+    // A timeout cancelled before either side completed counts as timed out
+    TimeoutResult await_resume() const noexcept {
+      return group.await_resume() == std::optional<std::size_t>{0} ? TimeoutResult::fired : TimeoutResult::timed_out;
+    }
+
+    bool cancel() noexcept {
+      return group.cancel();
+    }
+
+  private:
+    A awaitable;
+    Deadline deadline;
+    AwaitGroup<std::remove_reference_t<A>, Deadline> group;
+  };
+} // namespace test
+
+#endif // DUT_TOP_AWAITGROUP_HPP
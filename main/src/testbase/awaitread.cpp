@@ -24,6 +24,15 @@
 #include <cstdio>
 
 namespace test {
+  const std::string& detail::bin_str(t_read_value& value) {
+    if (value.strValue.empty() && !value.vecval.empty()) {
+      value.strValue.resize(value.vecval.size() * 32);
+      vecval_to_bin(value.vecval.data(), static_cast<unsigned int>(value.vecval.size()),
+                    value.strValue.data());
+    }
+    return value.strValue;
+  }
+
   // ============================================================
   // Core awaitable
   // ============================================================
@@ -36,29 +45,8 @@ namespace test {
                 static_cast<void*>(handle.address()));
 #endif
 
-    // Allocate callback data on heap (owned until callback fires)
-    auto callbackData = std::make_unique<scheduler::SchedulerCallbackData>();
-    callbackData->handle = h;
-
-    // Persistent time for Questa (MUST be non-null for cbReadOnlySynch)
-    detail::set_vpi_time_from_ticks(callbackData->time, delay_ticks);
-
-    // We don't need .vpi_value for cbReadOnlySynch, so leave it default-init
-
-    s_cb_data cb_data{};
-    cb_data.reason = cbReadOnlySynch;
-    cb_data.cb_rtn = &scheduler::read_callback;
-    cb_data.obj = nullptr;
-    cb_data.time = &callbackData->time; // <<< IMPORTANT: non-null persistent time
-    cb_data.value = nullptr; // allowed for cbReadOnlySynch
-    cb_data.user_data =
-      reinterpret_cast<PLI_BYTE8*>(callbackData.get());
-
-#ifdef RAPIDVPI_DEBUG
-    std::printf("[DBG] AwaitRead::await_suspend: calling vpi_register_cb (cbReadOnlySynch)\n");
-#endif
-    vpiHandle cbH = vpi_register_cb(&cb_data);
-    if (cbH == nullptr) {
+    // Readers due at the same tick share one cbReadOnlySynch
+    if (!scheduler::read_sync_wait(delay_ticks, h)) {
       std::printf("[WARNING]\tCannot register VPI Callback. TestBase::AwaitRead:: %s\n",
                   __FUNCTION__);
 
@@ -73,20 +61,19 @@ namespace test {
       else {
         std::printf("[VPI ERROR]\tNo additional VPI error info.\n");
       }
-
-      cb_handle = nullptr;
-      // unique_ptr auto-frees callbackData
-      return;
     }
 
-#ifdef RAPIDVPI_DEBUG
-    std::printf("[DBG] AwaitRead::await_suspend: vpi_register_cb OK, cb_handle=%p\n",
-                static_cast<void*>(cbH));
-#endif
+    cb_handle = nullptr;
+  }
+
+  bool TestBase::AwaitRead::cancel() noexcept {
+    if (!handle) {
+      return false;
+    }
 
-    // Hand ownership of callbackData to the simulator callback
-    (void)callbackData.release();
-    cb_handle = cbH;
+    const bool cancelled = scheduler::read_sync_cancel(handle);
+    handle = nullptr;
+    return cancelled;
   }
 
   void TestBase::AwaitRead::await_resume() noexcept {
@@ -102,58 +89,42 @@ namespace test {
                 grouped_reads.size());
 #endif
 
-    s_vpi_value read_val{};
-    read_val.format = vpiVectorVal;
-
     for (auto& pair : grouped_reads) {
-      const std::string& netStr = pair.first;
+      const Net& net = pair.first;
+      if (!net.valid()) {
+        continue; // already reported when the read was requested
+      }
 #ifdef RAPIDVPI_DEBUG
-      std::printf("[DBG] AwaitRead::await_resume: reading net '%s'\n", netStr.c_str());
+      std::printf("[DBG] AwaitRead::await_resume: reading net '%s'\n", net.name());
 #endif
 
-      vpi_get_value(parent.getNetHandle(netStr), &read_val);
-
       const unsigned int vecval_len =
-        (parent.getNetLength(netStr) + 31) / 32; // number of 32-bit chunks required
-
-      std::string final_strValue;
-      final_strValue.reserve(vecval_len * 32);
-
-      // Build numeric and string versions
-      for (int i = static_cast<int>(vecval_len) - 1; i >= 0; --i) {
-        const unsigned int avalue = read_val.value.vector[i].aval;
-        const unsigned int bvalue = read_val.value.vector[i].bval;
-
-        // Only keep up to 64 bits numerically (2 x 32-bit chunks)
-        if (vecval_len - static_cast<unsigned int>(i) <= 2) {
-          pair.second.uintValues.push_back(avalue);
-        }
-
-        for (int j = 31; j >= 0; --j) {
-          char bit_representation;
-          const bool a_bit = (avalue & (1u << j)) != 0;
-          const bool b_bit = (bvalue & (1u << j)) != 0;
-
-          if (b_bit) {
-            bit_representation = a_bit ? 'x' : 'z';
-          }
-          else {
-            bit_representation = a_bit ? '1' : '0';
-          }
-          final_strValue.push_back(bit_representation);
-        }
+        (net.length() + 31) / 32; // number of 32-bit chunks required
+
+      // Memoized per net for the rest of this read-only batch
+      const s_vpi_vecval* vector = scheduler::read_sync_vector(net.handle(), net.format(), net.length());
+
+      t_read_value& value = pair.second;
+      value.vecval.assign(vector, vector + vecval_len);
+
+      // Each await replaces the previous value of a reused awaitable.
+      // Only keep up to 64 bits numerically (2 x 32-bit chunks), MS chunk first
+      value.uintValues.clear();
+      for (unsigned int k = 0; k < std::min(vecval_len, 2u); ++k) {
+        value.uintValues.push_back(static_cast<unsigned int>(vector[vecval_len - 1 - k].aval));
       }
 
-      pair.second.strValue = std::move(final_strValue);
+      // Built from vecval by the first getBinStr
+      value.strValue.clear();
 #ifdef RAPIDVPI_DEBUG
-      std::printf("[DBG] AwaitRead::await_resume: net '%s' strValue length=%zu\n",
-                  netStr.c_str(), pair.second.strValue.length());
+      std::printf("[DBG] AwaitRead::await_resume: net '%s' vecval words=%zu\n",
+                  net.name(), value.vecval.size());
 #endif
     }
 
     // NOTE:
     //  - cbReadOnlySynch is one-shot; Questa removes the callback after firing.
-    //  - Our scheduler::read_callback deletes SchedulerCallbackData.
+    //  - The batch callback is owned by scheduler::read_sync_callback.
     //  - Here we just clear local book-keeping; no vpi_remove_cb().
     cb_handle = nullptr;
   }
@@ -161,54 +132,73 @@ namespace test {
   // ============================================================
   // Value getters
   // ============================================================
-  std::string TestBase::AwaitRead::getStr(const std::string& netStr,
+  t_read_value* TestBase::AwaitRead::findRead(const Net& net) {
+    for (auto& pair : grouped_reads) {
+      if (pair.first == net) {
+        return &pair.second;
+      }
+    }
+    return nullptr;
+  }
+
+  std::string TestBase::AwaitRead::getStr(const Net& net,
                                           const unsigned int base) {
     constexpr char EMPTY_STRING[] = "";
-    if (const auto result = grouped_reads.find(netStr); result != grouped_reads.end()) {
+    if (t_read_value* result = findRead(net); result != nullptr) {
       if (base == 16) {
-        return bin_to_hex(result->second.strValue);
+        return detail::vecval_to_hex(result->vecval.data(),
+                                     static_cast<unsigned int>(result->vecval.size()));
       }
-      return result->second.strValue;
+      return detail::bin_str(*result);
     }
 
-    std::printf("[WARNING]\tNo value for net: %s\n", netStr.c_str());
+    std::printf("[WARNING]\tNo value for net: %s\n", net.name());
     return EMPTY_STRING;
   }
 
-  std::string TestBase::AwaitRead::getBinStr(const std::string& netStr) {
-    return getStr(netStr, 2);
+  std::string TestBase::AwaitRead::getBinStr(const Net& net) {
+    return getStr(net, 2);
   }
 
-  std::string TestBase::AwaitRead::getHexStr(const std::string& netStr) {
-    return getStr(netStr, 16);
+  std::string TestBase::AwaitRead::getHexStr(const Net& net) {
+    return getStr(net, 16);
+  }
+
+  BitVector TestBase::AwaitRead::getBits(const Net& net) {
+    if (const t_read_value* result = findRead(net); result != nullptr && !result->vecval.empty()) {
+      return BitVector(result->vecval.data(), net.length());
+    }
+
+    std::printf("[WARNING]\tNo value for net: %s\n", net.name());
+    return BitVector();
   }
 
-  unsigned long long int TestBase::AwaitRead::getNum(const std::string& netStr) {
-    if (const auto result = grouped_reads.find(netStr); result != grouped_reads.end()) {
-      if (const size_t value_count = result->second.uintValues.size(); value_count == 1) {
-        unsigned int single_value = result->second.uintValues.back();
-        result->second.uintValues.pop_back();
+  unsigned long long int TestBase::AwaitRead::getNum(const Net& net) {
+    if (t_read_value* result = findRead(net); result != nullptr) {
+      if (const size_t value_count = result->uintValues.size(); value_count == 1) {
+        unsigned int single_value = result->uintValues.back();
+        result->uintValues.pop_back();
         return single_value;
       }
 
-      if (result->second.uintValues.size() >= 2) {
-        unsigned int value_low = result->second.uintValues.back();
-        result->second.uintValues.pop_back();
-        unsigned int value_high = result->second.uintValues.back();
-        result->second.uintValues.pop_back();
+      if (result->uintValues.size() >= 2) {
+        unsigned int value_low = result->uintValues.back();
+        result->uintValues.pop_back();
+        unsigned int value_high = result->uintValues.back();
+        result->uintValues.pop_back();
         return (static_cast<unsigned long long int>(value_high) << 32) | value_low;
       }
     }
 
-    std::printf("[WARNING]\tNo value for net: %s\n", netStr.c_str());
+    std::printf("[WARNING]\tNo value for net: %s\n", net.name());
     return 0;
   }
 
-  void TestBase::AwaitRead::read(const std::string& netStr) {
+  void TestBase::AwaitRead::read(const Net& net) {
     constexpr char EMPTY_STRING[] = "";
     t_read_value readValue;
     readValue.uintValues = {};
     readValue.strValue = EMPTY_STRING;
-    grouped_reads.insert(std::make_pair(netStr, readValue));
+    detail::insert_net_op(grouped_reads, net, std::move(readValue));
   }
 } // namespace test
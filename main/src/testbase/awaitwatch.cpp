@@ -0,0 +1,84 @@
+// MIT License
+//
+// Copyright (c) 2024 Rovshan Rustamov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "testbase.hpp"
+#include <cstdint>
+#include <cstdio>
+
+namespace test {
+  namespace {
+    // scheduler::WatchSet::check for AwaitWatch
+    bool watch_check(void* ctx) {
+      return static_cast<TestBase::AwaitWatch*>(ctx)->await_ready();
+    }
+  } // namespace
+
+  bool TestBase::AwaitWatch::await_ready() {
+    return check_();
+  }
+
+  bool TestBase::AwaitWatch::check_() {
+    for (std::size_t i = 0; i < nets.size(); ++i) {
+      const unsigned int width = nets[i].length();
+      const s_vpi_vecval* value = scheduler::get_value_words(nets[i].handle(), nets[i].format(), width);
+
+      unsigned long long int num = static_cast<std::uint32_t>(value[0].aval);
+      if (width > 32) {
+        num |= static_cast<unsigned long long int>(static_cast<std::uint32_t>(value[1].aval)) << 32;
+      }
+      values[i] = num;
+    }
+    return predicate(values);
+  }
+
+  void TestBase::AwaitWatch::await_suspend(std::coroutine_handle<> h) {
+    watch.handle = h;
+    watch.check = &watch_check;
+    watch.ctx = this;
+
+    std::vector<vpiHandle> handles;
+    handles.reserve(nets.size());
+    for (const Net& net : nets) {
+      if (net.handle() == nullptr) {
+        std::printf("[ERROR]\tAwaitWatch::await_suspend: net '%s' has NULL handle, "
+                    "cannot register cbValueChange.\n",
+                    net.name());
+        return;
+      }
+      handles.push_back(net.handle());
+    }
+
+    if (!scheduler::watch_arm(watch, handles)) {
+      std::printf("[WARNING]\tCannot register VPI Callback. TestBase::AwaitWatch:: %s\n",
+                  __FUNCTION__);
+    }
+  }
+
+  void TestBase::AwaitWatch::await_resume() noexcept {
+    // 'values' holds what the predicate accepted
+    resume_time_ticks = detail::current_vpi_time_ticks();
+  }
+
+  bool TestBase::AwaitWatch::cancel() noexcept {
+    return scheduler::watch_disarm(watch);
+  }
+} // namespace test
@@ -20,10 +20,94 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+
 #include "testbase.hpp"
+#include <algorithm>
 #include <cstdio>
+#include <stdexcept>
 
 namespace test {
+  namespace {
+    // Pack a numeric value into 'vecval_len' zeroed 32-bit chunks
+    void pack_numeric(unsigned long long int value,
+                      const unsigned int vecval_len,
+                      s_vpi_vecval* write_vecval) {
+      // Split the value into 32-bit chunks and store them in write_vecval
+      for (unsigned int i = 0; i < vecval_len && value != 0; ++i) {
+        write_vecval[i].aval = static_cast<PLI_INT32>(value & 0xFFFFFFFFu); // Extract 32 bits
+        value >>= 32; // next chunk
+      }
+    }
+
+    // Pack a hex (base 16) or binary string straight into 'vecval_len' chunks
+    void pack_string(const std::string& value,
+                     const unsigned int base,
+                     const unsigned int vecval_len,
+                     s_vpi_vecval* write_vecval) {
+      if (base == 16) {
+        if (!detail::hex_to_vecval(value, write_vecval, vecval_len)) {
+          throw std::invalid_argument("Invalid hex character");
+        }
+      }
+      else if (!detail::bin_to_vecval(value, write_vecval, vecval_len)) {
+        std::printf("[WARNING]\tInvalid binary character used in write(): %s\n", value.c_str());
+      }
+    }
+  } // namespace
+
+  TestBase::AwaitWaveform TestBase::scheduleWaveform(const Net& net,
+                                                     const std::span<const WaveStep> steps,
+                                                     PLI_INT32 delay_mode) {
+    if (delay_mode != vpiTransportDelay && delay_mode != vpiPureTransportDelay &&
+        delay_mode != vpiInertialDelay) {
+      std::printf("[WARNING]\tscheduleWaveform() delay mode %d is not a VPI delay, using vpiTransportDelay\n",
+                  static_cast<int>(delay_mode));
+      delay_mode = vpiTransportDelay;
+    }
+
+    const sim_tick_t now = detail::current_vpi_time_ticks();
+    sim_tick_t at = 0;
+    if (!net.valid()) {
+      return AwaitWaveform{now}; // reported by the net lookup
+    }
+
+    // Every step is put from this time step's write flush, delayed by its
+    // offset from now; steps at offset 0 become plain writes
+    const unsigned int vecval_len = (net.length() + 31) / 32;
+    for (const WaveStep& step : steps) {
+      at += step.delta_ticks;
+      s_vpi_vecval* storage =
+        scheduler::write_buffer_stage_delayed(net.handle(), at, delay_mode, vecval_len);
+      pack_numeric(step.value, vecval_len, storage);
+    }
+
+    return AwaitWaveform{now + at};
+  }
+
+  void TestBase::AwaitWaveform::await_suspend(std::coroutine_handle<> h) {
+    handle = h;
+
+    // The last transition is still ahead, or at this tick in the pending flush
+    const sim_tick_t now = detail::current_vpi_time_ticks();
+    const bool armed = end_ticks > now
+                         ? scheduler::timer_wheel_schedule(end_ticks - now, h)
+                         : scheduler::write_buffer_wait(h);
+    if (!armed) {
+      std::printf("[WARNING]\tCannot register VPI Callback. TestBase::AwaitWaveform:: %s\n",
+                  __FUNCTION__);
+    }
+  }
+
+  bool TestBase::AwaitWaveform::cancel() noexcept {
+    if (!handle) {
+      return false;
+    }
+
+    const bool cancelled = scheduler::timer_wheel_cancel(handle) || scheduler::write_buffer_cancel(handle);
+    handle = nullptr;
+    return cancelled;
+  }
+
   void TestBase::AwaitWrite::await_suspend(std::coroutine_handle<> h) {
     handle = h;
 
@@ -33,28 +117,34 @@ namespace test {
                 static_cast<void*>(handle.address()));
 #endif
 
-    auto callbackData = std::make_unique<scheduler::SchedulerCallbackData>();
-    callbackData->handle = h;
-
-    // Time for the delay is only needed at registration;
-    // the simulator copies it, so stack lifetime is enough.
-    s_vpi_time time{};
-    detail::set_vpi_time_from_ticks(time, delay_ticks);
-
-    s_cb_data cb_data{};
-    cb_data.reason = cbAfterDelay;
-    cb_data.cb_rtn = &scheduler::write_callback;
-    cb_data.obj = nullptr;
-    cb_data.time = &time; // stack object, read at registration
-    cb_data.value = nullptr; // not used for cbAfterDelay
+    // Delayed writes share the scheduler's timer wheel, which keeps a single
+    // cbAfterDelay armed for the earliest deadline. Values are put when the
+    // coroutine resumes at the target tick.
+    if (delay_ticks > 0) {
+      if (!scheduler::timer_wheel_schedule(delay_ticks, h)) {
+        std::printf("[WARNING]\tCannot schedule delayed write. TestBase::AwaitWrite:: %s\n",
+                    __FUNCTION__);
+      }
+      cb_handle = nullptr;
+      return;
+    }
 
-    cb_data.user_data = reinterpret_cast<PLI_BYTE8*>(callbackData.get());
+    // Zero-delay writes are copied now into the scheduler's write-combining
+    // buffer, which puts every write of this time step from one callback.
+    for (std::size_t i = 0; i < op_count; ++i) {
+      WriteOp& write_op = op(i);
 
 #ifdef RAPIDVPI_DEBUG
-    std::printf("[DBG] AwaitWrite::await_suspend: calling vpi_register_cb (cbAfterDelay)\n");
+      std::printf("[DBG] AwaitWrite::await_suspend: staging net '%s', len=%u, flag=%d\n",
+                  write_op.net.name(), write_op.net.length(), write_op.flag);
 #endif
-    vpiHandle cbH = vpi_register_cb(&cb_data);
-    if (cbH == nullptr) {
+
+      s_vpi_vecval* storage =
+        scheduler::write_buffer_stage(write_op.net.handle(), write_op.flag, write_op.vecval_len);
+      std::copy_n(opVecval(write_op), write_op.vecval_len, storage);
+    }
+
+    if (!scheduler::write_buffer_wait(h)) {
       std::printf("[WARNING]\tCannot register VPI Callback. TestBase::AwaitWrite:: %s\n",
                   __FUNCTION__);
 
@@ -69,156 +159,147 @@ namespace test {
       else {
         std::printf("[VPI ERROR]\tNo additional VPI error info.\n");
       }
-
-      cb_handle = nullptr;
-      return;
     }
 
-#ifdef RAPIDVPI_DEBUG
-    std::printf("[DBG] AwaitWrite::await_suspend: vpi_register_cb OK, cb_handle=%p\n",
-                static_cast<void*>(cbH));
-#endif
-
-    (void)callbackData.release(); // ownership moves to scheduler::write_callback
-    cb_handle = cbH;
+    cb_handle = nullptr;
   }
 
   void TestBase::AwaitWrite::await_resume() noexcept {
 #ifdef RAPIDVPI_DEBUG
-    std::printf("[DBG] AwaitWrite::await_resume enter, grouped_writes=%zu\n",
-                grouped_writes.size());
+    std::printf("[DBG] AwaitWrite::await_resume enter, writes=%zu\n", op_count);
 #endif
 
-    s_vpi_value val{};
-    val.format = vpiVectorVal;
+    // Zero-delay writes were already put by scheduler::write_buffer_callback
+    if (delay_ticks > 0) {
+      s_vpi_value val{};
+      val.format = vpiVectorVal;
 
-    // Scan through grouped_writes and perform write for each record
-    for (const auto& pair : grouped_writes) {
-      const std::string& key = pair.first;
-      const unsigned int vecval_len =
-        (parent.getNetLength(key) + 31) / 32; // number of 32-bit chunks required
-
-      std::vector<s_vpi_vecval> write_vecval(vecval_len, {0, 0}); // Initialize all elements
+      // Values were packed when the writes were requested
+      for (std::size_t i = 0; i < op_count; ++i) {
+        WriteOp& write_op = op(i);
+        val.value.vector = opVecval(write_op);
 
 #ifdef RAPIDVPI_DEBUG
-      std::printf("[DBG] AwaitWrite::await_resume: net='%s', len=%u, flag=%d\n",
-                  key.c_str(), parent.getNetLength(key), pair.second.flag);
+        std::printf("[DBG] AwaitWrite::await_resume: calling vpi_put_value on '%s', len=%u, flag=%d\n",
+                    write_op.net.name(), write_op.net.length(), write_op.flag);
 #endif
+        vpi_put_value(write_op.net.handle(), &val, nullptr, write_op.flag);
+      }
+    }
 
-      if (pair.second.strValue.empty()) {
-        // Handle numeric write
-        unsigned long long int temp_value = pair.second.ullValue;
+    // Done operations, remove them from the list
+    clearOps();
 
-        // Split the value into 32-bit chunks and store them in write_vecval
-        for (unsigned int i = 0; i < vecval_len; ++i) {
-          write_vecval[i].aval = static_cast<PLI_INT32>(temp_value & 0xFFFFFFFFu); // Extract 32 bits
-          write_vecval[i].bval = 0; // no bval used here
-          temp_value >>= 32; // next chunk
-        }
-      }
-      else {
-        // Handle string write
-        const std::string& value = pair.second.strValue;
-
-        // Fill write_vecval with bits from the string in reverse order
-        size_t bit_index = 0;
-        for (auto it = value.rbegin(); it != value.rend(); ++it, ++bit_index) {
-          const size_t vecval_index = bit_index / 32;
-          const size_t bit_position = bit_index % 32;
-          const auto bit_mask = static_cast<PLI_INT32>(1u << bit_position);
-
-          switch (*it) {
-          case '1':
-            write_vecval[vecval_index].aval |= bit_mask;
-            break;
-          case '0':
-            // already 0
-            break;
-          case 'x':
-            write_vecval[vecval_index].aval |= bit_mask; // 1
-            write_vecval[vecval_index].bval |= bit_mask; // X
-            break;
-          case 'z':
-            write_vecval[vecval_index].aval &= ~bit_mask; // 0
-            write_vecval[vecval_index].bval |= bit_mask; // Z
-            break;
-          default:
-            std::printf("[WARNING]\tInvalid binary character used in write(): %c\n", *it);
-            break;
-          }
-        }
+    // Both the timer wheel and the write buffer own their callbacks
+    cb_handle = nullptr;
+  }
+
+  bool TestBase::AwaitWrite::cancel() noexcept {
+    if (!handle) {
+      return false;
+    }
+
+    // Delayed writes are put on resume, so a withdrawn timer puts nothing
+    const bool cancelled = delay_ticks > 0
+                             ? scheduler::timer_wheel_cancel(handle)
+                             : scheduler::write_buffer_cancel(handle);
+    handle = nullptr;
+    return cancelled;
+  }
+
+  TestBase::AwaitWrite::WriteOp& TestBase::AwaitWrite::op(const std::size_t index) {
+    return index < inline_writes ? inline_ops[index] : spill_ops[index - inline_writes];
+  }
+
+  s_vpi_vecval* TestBase::AwaitWrite::opVecval(WriteOp& write_op) {
+    return write_op.vecval_len <= 2
+             ? write_op.inline_vecval
+             : wide_vecvals.data() + write_op.wide_offset;
+  }
+
+  s_vpi_vecval* TestBase::AwaitWrite::addOp(const Net& net, const PLI_INT32 flag) {
+    if (!net.valid()) {
+      return nullptr; // reported by the net lookup
+    }
+
+    // The first request for a net wins until the list is applied
+    for (std::size_t i = 0; i < op_count; ++i) {
+      if (op(i).net == net) {
+        return nullptr;
       }
+    }
 
-      val.value.vector = write_vecval.data();
+    WriteOp write_op{};
+    write_op.net = net;
+    write_op.flag = flag;
+    write_op.vecval_len = (net.length() + 31) / 32; // number of 32-bit chunks required
+    if (write_op.vecval_len > 2) {
+      write_op.wide_offset = wide_vecvals.size();
+      wide_vecvals.resize(wide_vecvals.size() + write_op.vecval_len, s_vpi_vecval{0, 0});
+    }
 
-#ifdef RAPIDVPI_DEBUG
-      std::printf("[DBG] AwaitWrite::await_resume: calling vpi_put_value on '%s'\n",
-                  key.c_str());
-#endif
-      vpi_put_value(parent.getNetHandle(key), &val, nullptr, pair.second.flag);
+    WriteOp* stored;
+    if (op_count < inline_writes) {
+      stored = &inline_ops[op_count];
+      *stored = write_op;
+    }
+    else {
+      stored = &spill_ops.emplace_back(write_op);
     }
+    ++op_count;
 
-    // Done operations, remove them from the list
-    grouped_writes.clear();
-    grouped_writes.rehash(0);
+    return opVecval(*stored);
+  }
 
-    // cbAfterDelay is one-shot; simulator removes callback.
-    // scheduler::write_callback has already freed the user_data.
-    cb_handle = nullptr;
+  void TestBase::AwaitWrite::clearOps() {
+    op_count = 0;
+    spill_ops.clear();
+    wide_vecvals.clear();
   }
 
-  void TestBase::AwaitWrite::write(const std::string& netStr,
+  void TestBase::AwaitWrite::write(const Net& net,
                                    const unsigned long long int value) {
-    t_write_value write_value{};
-    write_value.flag = vpiNoDelay;
-    write_value.ullValue = value;
-    grouped_writes.insert(std::make_pair(netStr, write_value));
+    if (s_vpi_vecval* storage = addOp(net, vpiNoDelay); storage != nullptr) {
+      pack_numeric(value, (net.length() + 31) / 32, storage);
+    }
   }
 
-  void TestBase::AwaitWrite::force(const std::string& netStr,
+  void TestBase::AwaitWrite::force(const Net& net,
                                    const unsigned long long int value) {
-    t_write_value write_value{};
-    write_value.flag = vpiForceFlag;
-    write_value.ullValue = value;
-    grouped_writes.insert(std::make_pair(netStr, write_value));
+    if (s_vpi_vecval* storage = addOp(net, vpiForceFlag); storage != nullptr) {
+      pack_numeric(value, (net.length() + 31) / 32, storage);
+    }
   }
 
-  void TestBase::AwaitWrite::release(const std::string& netStr) {
-    t_write_value write_value{};
-    write_value.flag = vpiReleaseFlag;
-    write_value.ullValue = 0;
-    grouped_writes.insert(std::make_pair(netStr, write_value));
+  void TestBase::AwaitWrite::release(const Net& net) {
+    (void)addOp(net, vpiReleaseFlag);
   }
 
-  void TestBase::AwaitWrite::write(const std::string& netStr,
-                                   const std::string& valStr,
-                                   const unsigned int base) {
-    t_write_value write_value{};
-    write_value.flag = vpiNoDelay;
-
-    if (base == 16) {
-      write_value.strValue = hex_to_bin(valStr);
-    }
-    else {
-      write_value.strValue = valStr;
+  void TestBase::AwaitWrite::write(const Net& net, const BitVector& value) {
+    if (s_vpi_vecval* storage = addOp(net, vpiNoDelay); storage != nullptr) {
+      std::copy_n(value.data(), std::min(value.wordCount(), (net.length() + 31) / 32), storage);
     }
+  }
 
-    grouped_writes.insert(std::make_pair(netStr, write_value));
+  void TestBase::AwaitWrite::force(const Net& net, const BitVector& value) {
+    if (s_vpi_vecval* storage = addOp(net, vpiForceFlag); storage != nullptr) {
+      std::copy_n(value.data(), std::min(value.wordCount(), (net.length() + 31) / 32), storage);
+    }
   }
 
-  void TestBase::AwaitWrite::force(const std::string& netStr,
+  void TestBase::AwaitWrite::write(const Net& net,
                                    const std::string& valStr,
                                    const unsigned int base) {
-    t_write_value write_value{};
-    write_value.flag = vpiForceFlag;
-
-    if (base == 16) {
-      write_value.strValue = hex_to_bin(valStr);
-    }
-    else {
-      write_value.strValue = valStr;
+    if (s_vpi_vecval* storage = addOp(net, vpiNoDelay); storage != nullptr) {
+      pack_string(valStr, base, (net.length() + 31) / 32, storage);
     }
+  }
 
-    grouped_writes.insert(std::make_pair(netStr, write_value));
+  void TestBase::AwaitWrite::force(const Net& net,
+                                   const std::string& valStr,
+                                   const unsigned int base) {
+    if (s_vpi_vecval* storage = addOp(net, vpiForceFlag); storage != nullptr) {
+      pack_string(valStr, base, (net.length() + 31) / 32, storage);
+    }
   }
 } // namespace test
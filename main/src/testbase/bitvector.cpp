@@ -0,0 +1,288 @@
+// MIT License
+//
+// Copyright (c) 2024 Rovshan Rustamov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "bitvector.hpp"
+#include "vecvalcodec.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdio>
+
+namespace test {
+  namespace {
+    [[nodiscard]] std::uint32_t word_a(const s_vpi_vecval& word) noexcept {
+      return static_cast<std::uint32_t>(word.aval);
+    }
+
+    [[nodiscard]] std::uint32_t word_b(const s_vpi_vecval& word) noexcept {
+      return static_cast<std::uint32_t>(word.bval);
+    }
+  } // namespace
+
+  BitVector::BitVector(const unsigned int width) {
+    allocate_(width);
+  }
+
+  BitVector::BitVector(const unsigned int width, unsigned long long int value) {
+    allocate_(width);
+    s_vpi_vecval* words = data();
+    for (unsigned int i = 0; i < wordCount() && value != 0; ++i) {
+      words[i].aval = static_cast<PLI_INT32>(value & 0xFFFFFFFFu);
+      value >>= 32;
+    }
+    clearUnused_();
+  }
+
+  BitVector::BitVector(const s_vpi_vecval* words, const unsigned int width) {
+    allocate_(width);
+    std::copy_n(words, wordCount(), data());
+    clearUnused_();
+  }
+
+  BitVector BitVector::filled(const unsigned int width, const char state) {
+    BitVector result(width);
+    const bool a = state == '1' || state == 'x' || state == 'X';
+    const bool b = state == 'x' || state == 'X' || state == 'z' || state == 'Z';
+    const s_vpi_vecval fill{a ? -1 : 0, b ? -1 : 0};
+    std::fill_n(result.data(), result.wordCount(), fill);
+    result.clearUnused_();
+    return result;
+  }
+
+  BitVector BitVector::fromString(const std::string_view value,
+                                  const unsigned int width,
+                                  const unsigned int base) {
+    BitVector result(width);
+    const bool ok = base == 16
+                      ? detail::hex_to_vecval(value, result.data(), result.wordCount())
+                      : detail::bin_to_vecval(value, result.data(), result.wordCount());
+    if (!ok) {
+      std::printf("[WARNING]\tInvalid character in BitVector value: %.*s\n",
+                  static_cast<int>(value.size()), value.data());
+    }
+    result.clearUnused_();
+    return result;
+  }
+
+  BitVector::BitVector(const BitVector& other) {
+    allocate_(other.width_);
+    std::copy_n(other.data(), wordCount(), data());
+  }
+
+  BitVector& BitVector::operator=(const BitVector& other) {
+    if (this != &other) {
+      if (wordCount() != other.wordCount()) {
+        allocate_(other.width_);
+      }
+      width_ = other.width_;
+      std::copy_n(other.data(), wordCount(), data());
+    }
+    return *this;
+  }
+
+  BitVector::BitVector(BitVector&& other) noexcept
+    : width_(other.width_)
+      , heap_(std::move(other.heap_)) {
+    std::copy_n(other.inline_, inline_words, inline_);
+    other.width_ = 0;
+  }
+
+  BitVector& BitVector::operator=(BitVector&& other) noexcept {
+    if (this != &other) {
+      width_ = other.width_;
+      heap_ = std::move(other.heap_);
+      std::copy_n(other.inline_, inline_words, inline_);
+      other.width_ = 0;
+    }
+    return *this;
+  }
+
+  bool BitVector::operator==(const BitVector& other) const noexcept {
+    // Bits above the width are always 0, so whole words compare
+    if (width_ != other.width_) {
+      return false;
+    }
+
+    const s_vpi_vecval* a = data();
+    const s_vpi_vecval* b = other.data();
+    for (unsigned int i = 0; i < wordCount(); ++i) {
+      if (a[i].aval != b[i].aval || a[i].bval != b[i].bval) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool BitVector::matches(const BitVector& expected, const BitVector& mask) const noexcept {
+    if (width_ != expected.width_ || width_ != mask.width_) {
+      return false;
+    }
+
+    const s_vpi_vecval* v = data();
+    const s_vpi_vecval* e = expected.data();
+    const s_vpi_vecval* m = mask.data();
+    for (unsigned int i = 0; i < wordCount(); ++i) {
+      const std::uint32_t care = word_a(m[i]) & ~word_b(m[i]);
+      const std::uint32_t diff = (word_a(v[i]) ^ word_a(e[i])) | (word_b(v[i]) ^ word_b(e[i]));
+      if ((diff & care) != 0) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool BitVector::hasX() const noexcept {
+    const s_vpi_vecval* words = data();
+    for (unsigned int i = 0; i < wordCount(); ++i) {
+      if ((word_a(words[i]) & word_b(words[i])) != 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool BitVector::hasZ() const noexcept {
+    const s_vpi_vecval* words = data();
+    for (unsigned int i = 0; i < wordCount(); ++i) {
+      if ((~word_a(words[i]) & word_b(words[i])) != 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool BitVector::hasXZ() const noexcept {
+    const s_vpi_vecval* words = data();
+    for (unsigned int i = 0; i < wordCount(); ++i) {
+      if (words[i].bval != 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  unsigned int BitVector::popcount() const noexcept {
+    const s_vpi_vecval* words = data();
+    unsigned int count = 0;
+    for (unsigned int i = 0; i < wordCount(); ++i) {
+      count += static_cast<unsigned int>(std::popcount(word_a(words[i]) & ~word_b(words[i])));
+    }
+    return count;
+  }
+
+  BitVector BitVector::slice(const unsigned int lsb, const unsigned int width) const {
+    BitVector result(width);
+    const s_vpi_vecval* src = data();
+    s_vpi_vecval* dst = result.data();
+    const unsigned int src_words = wordCount();
+    const unsigned int word_shift = lsb / 32;
+    const unsigned int bit_shift = lsb % 32;
+
+    // Each destination word straddles at most two source words
+    const auto source = [&](const unsigned int index) {
+      return index < src_words ? src[index] : s_vpi_vecval{0, 0};
+    };
+    for (unsigned int i = 0; i < result.wordCount(); ++i) {
+      const s_vpi_vecval low = source(word_shift + i);
+      std::uint32_t aval = word_a(low) >> bit_shift;
+      std::uint32_t bval = word_b(low) >> bit_shift;
+      if (bit_shift != 0) {
+        const s_vpi_vecval high = source(word_shift + i + 1);
+        aval |= word_a(high) << (32 - bit_shift);
+        bval |= word_b(high) << (32 - bit_shift);
+      }
+      dst[i].aval = static_cast<PLI_INT32>(aval);
+      dst[i].bval = static_cast<PLI_INT32>(bval);
+    }
+
+    result.clearUnused_();
+    return result;
+  }
+
+  char BitVector::bit(const unsigned int index) const noexcept {
+    if (index >= width_) {
+      return '0';
+    }
+
+    const s_vpi_vecval& word = data()[index / 32];
+    const bool a = (word_a(word) >> (index % 32)) & 1u;
+    if ((word_b(word) >> (index % 32)) & 1u) {
+      return a ? 'x' : 'z';
+    }
+    return a ? '1' : '0';
+  }
+
+  void BitVector::setBit(const unsigned int index, const char state) noexcept {
+    if (index >= width_) {
+      return;
+    }
+
+    s_vpi_vecval& word = data()[index / 32];
+    const std::uint32_t mask = 1u << (index % 32);
+    const bool a = state == '1' || state == 'x' || state == 'X';
+    const bool b = state == 'x' || state == 'X' || state == 'z' || state == 'Z';
+    word.aval = static_cast<PLI_INT32>(a ? word_a(word) | mask : word_a(word) & ~mask);
+    word.bval = static_cast<PLI_INT32>(b ? word_b(word) | mask : word_b(word) & ~mask);
+  }
+
+  unsigned long long int BitVector::toNum() const noexcept {
+    const s_vpi_vecval* words = data();
+    unsigned long long int value = 0;
+    for (unsigned int i = std::min(wordCount(), 2u); i-- > 0;) {
+      value = (value << 32) | word_a(words[i]);
+    }
+    return value;
+  }
+
+  std::string BitVector::toBinStr() const {
+    // Exactly 'width' characters, unlike the whole-word AwaitRead strings
+    std::string bin(static_cast<std::size_t>(wordCount()) * 32, '0');
+    detail::vecval_to_bin(data(), wordCount(), bin.data());
+    bin.erase(0, bin.size() - width_);
+    return bin;
+  }
+
+  std::string BitVector::toHexStr() const {
+    return detail::vecval_to_hex(data(), wordCount());
+  }
+
+  void BitVector::allocate_(const unsigned int width) {
+    width_ = width;
+    std::fill_n(inline_, inline_words, s_vpi_vecval{0, 0});
+    if (wordCount() > inline_words) {
+      heap_ = std::make_unique<s_vpi_vecval[]>(wordCount()); // value-initialized
+    }
+    else {
+      heap_.reset();
+    }
+  }
+
+  void BitVector::clearUnused_() noexcept {
+    if (const unsigned int top_bits = width_ % 32; top_bits != 0) {
+      s_vpi_vecval& top = data()[wordCount() - 1];
+      const std::uint32_t keep = (1u << top_bits) - 1;
+      top.aval = static_cast<PLI_INT32>(word_a(top) & keep);
+      top.bval = static_cast<PLI_INT32>(word_b(top) & keep);
+    }
+  }
+} // namespace test
@@ -0,0 +1,111 @@
+// MIT License
+//
+// Copyright (c) 2024 Rovshan Rustamov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+// Description: Four-state bit vector in VPI vecval layout (aval/bval word
+// pairs, least significant word first). Values of up to 64 bits live inside
+// the object; wider ones take a single heap block. Compare, X/Z detection,
+// slicing and popcount all work a word at a time, and data() can be handed to
+// vpi_put_value directly.
+
+#ifndef DUT_TOP_BITVECTOR_HPP
+#define DUT_TOP_BITVECTOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <vpi_user.h>
+
+namespace test {
+  class BitVector {
+  public:
+    static constexpr unsigned int inline_words = 2;
+
+    BitVector() noexcept = default;
+
+    // All-zero vector of 'width' bits
+    explicit BitVector(unsigned int width);
+
+    // 'value' zero-extended or truncated to 'width' bits
+    BitVector(unsigned int width, unsigned long long int value);
+
+    // Copy of (width + 31) / 32 vecval words, as returned by vpi_get_value
+    BitVector(const s_vpi_vecval* words, unsigned int width);
+
+    // Every bit set to '0', '1', 'x' or 'z'
+    static BitVector filled(unsigned int width, char state);
+
+    // Binary (base 2) or hex (base 16) string, MSB first, sized to 'width'
+    static BitVector fromString(std::string_view value, unsigned int width, unsigned int base = 2);
+
+    BitVector(const BitVector& other);
+    BitVector& operator=(const BitVector& other);
+    BitVector(BitVector&& other) noexcept;
+    BitVector& operator=(BitVector&& other) noexcept;
+    ~BitVector() = default;
+
+    [[nodiscard]] unsigned int width() const noexcept { return width_; }
+    [[nodiscard]] unsigned int wordCount() const noexcept { return (width_ + 31) / 32; }
+    [[nodiscard]] const s_vpi_vecval* data() const noexcept { return heap_ ? heap_.get() : inline_; }
+    [[nodiscard]] s_vpi_vecval* data() noexcept { return heap_ ? heap_.get() : inline_; }
+
+    // Four-state equality (like ===): widths and every aval/bval bit match
+    [[nodiscard]] bool operator==(const BitVector& other) const noexcept;
+
+    // Equality on the bits that are 1 in 'mask'; all three widths must match
+    [[nodiscard]] bool matches(const BitVector& expected, const BitVector& mask) const noexcept;
+
+    [[nodiscard]] bool hasX() const noexcept;
+    [[nodiscard]] bool hasZ() const noexcept;
+    [[nodiscard]] bool hasXZ() const noexcept;
+    [[nodiscard]] bool isKnown() const noexcept { return !hasXZ(); }
+
+    // Number of bits that are 1 (x and z are not counted)
+    [[nodiscard]] unsigned int popcount() const noexcept;
+
+    // Bits [lsb + width - 1 : lsb]; bits past the end read as 0
+    [[nodiscard]] BitVector slice(unsigned int lsb, unsigned int width) const;
+
+    // '0', '1', 'x' or 'z'; bits past the end read as '0'
+    [[nodiscard]] char bit(unsigned int index) const noexcept;
+    void setBit(unsigned int index, char state) noexcept;
+
+    // Low 64 aval bits (x reads as 1, z as 0, like getNum)
+    [[nodiscard]] unsigned long long int toNum() const noexcept;
+
+    [[nodiscard]] std::string toBinStr() const;
+    [[nodiscard]] std::string toHexStr() const;
+
+  private:
+    void allocate_(unsigned int width);
+    void clearUnused_() noexcept; // keep bits above width at 0
+
+    unsigned int width_{0};
+    s_vpi_vecval inline_[inline_words]{};
+    std::unique_ptr<s_vpi_vecval[]> heap_;
+  };
+} // namespace test
+
+#endif // DUT_TOP_BITVECTOR_HPP
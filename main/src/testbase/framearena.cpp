@@ -0,0 +1,147 @@
+// MIT License
+//
+// Copyright (c) 2024 Rovshan Rustamov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "framearena.hpp"
+
+#include <cstdio>
+#include <new>
+
+namespace test::frame_arena {
+  namespace {
+    constexpr std::size_t class_count = class_sizes.size();
+    constexpr std::size_t blocks_per_slab = 32;
+
+    struct FreeBlock {
+      FreeBlock* next;
+    };
+
+    // Plain globals on purpose: frames of still-pending coroutines may be
+    // released during static destruction, so the arena itself never is.
+    // Slabs are carved once and kept for the lifetime of the process.
+    FrameClassStats class_stats[class_count + 1]{};
+
+#ifndef RAPIDVPI_NO_FRAME_ARENA
+    FreeBlock* free_lists[class_count]{};
+
+    std::size_t class_index(std::size_t size) noexcept {
+      std::size_t i = 0;
+      while (i < class_count && class_sizes[i] < size) {
+        ++i;
+      }
+      return i;
+    }
+
+    void grow(std::size_t index) {
+      const std::size_t block = class_sizes[index];
+      auto* slab = static_cast<unsigned char*>(::operator new(block * blocks_per_slab));
+
+      for (std::size_t i = blocks_per_slab; i-- > 0;) {
+        auto* b = reinterpret_cast<FreeBlock*>(slab + i * block);
+        b->next = free_lists[index];
+        free_lists[index] = b;
+      }
+
+      class_stats[index].capacity += blocks_per_slab;
+      ++class_stats[index].slabs;
+    }
+#endif
+
+    void count_alloc(FrameClassStats& st, std::size_t size) noexcept {
+      ++st.allocs;
+      st.live_bytes += size;
+      if (++st.live > st.peak) {
+        st.peak = st.live;
+      }
+    }
+
+    void count_free(FrameClassStats& st, std::size_t size) noexcept {
+      --st.live;
+      st.live_bytes -= size;
+    }
+  } // namespace
+
+  void* allocate(std::size_t size) {
+#ifdef RAPIDVPI_NO_FRAME_ARENA
+    count_alloc(class_stats[class_count], size);
+    return ::operator new(size);
+#else
+    const std::size_t index = class_index(size);
+    count_alloc(class_stats[index], size);
+
+    if (index == class_count) {
+      return ::operator new(size);
+    }
+
+    if (free_lists[index] == nullptr) {
+      grow(index);
+    }
+
+    FreeBlock* b = free_lists[index];
+    free_lists[index] = b->next;
+    return b;
+#endif
+  }
+
+  void deallocate(void* ptr, std::size_t size) noexcept {
+#ifdef RAPIDVPI_NO_FRAME_ARENA
+    count_free(class_stats[class_count], size);
+    ::operator delete(ptr, size);
+#else
+    const std::size_t index = class_index(size);
+    count_free(class_stats[index], size);
+
+    if (index == class_count) {
+      ::operator delete(ptr, size);
+      return;
+    }
+
+    auto* b = static_cast<FreeBlock*>(ptr);
+    b->next = free_lists[index];
+    free_lists[index] = b;
+#endif
+  }
+
+  const FrameClassStats& stats(std::size_t index) noexcept {
+    return class_stats[index < class_count ? index : class_count];
+  }
+
+  void print_stats() {
+    for (std::size_t i = 0; i <= class_count; ++i) {
+      const FrameClassStats& st = class_stats[i];
+      if (st.allocs == 0) {
+        continue;
+      }
+
+      if (i < class_count) {
+        std::printf("[INFO]\tRapidVPI frame arena <=%zuB: live=%zu peak=%zu live_bytes=%zu capacity=%zu slabs=%zu allocs=%llu\n",
+                    class_sizes[i], st.live, st.peak, st.live_bytes, st.capacity, st.slabs,
+                    static_cast<unsigned long long>(st.allocs));
+      }
+      else {
+        std::printf("[INFO]\tRapidVPI frame heap: live=%zu peak=%zu live_bytes=%zu allocs=%llu\n",
+                    st.live, st.peak, st.live_bytes,
+                    static_cast<unsigned long long>(st.allocs));
+      }
+    }
+  }
+} // namespace test::frame_arena
@@ -0,0 +1,56 @@
+// MIT License
+//
+// Copyright (c) 2024 Rovshan Rustamov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+// Description: Size-class arena for coroutine frames. RunTask and RunUserTask
+// route their frame allocation through here, so the short helper coroutines
+// spawned once per clock or bit reuse freed frames instead of hitting the heap.
+
+#ifndef DUT_TOP_FRAMEARENA_HPP
+#define DUT_TOP_FRAMEARENA_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace test::frame_arena {
+  // Block sizes of the size classes; larger frames go straight to the heap.
+  inline constexpr std::array<std::size_t, 6> class_sizes{64, 128, 256, 512, 1024, 2048};
+
+  struct FrameClassStats {
+    std::size_t live{}; // frames currently allocated
+    std::size_t peak{}; // high-water mark of live frames
+    std::size_t live_bytes{}; // requested frame bytes currently allocated
+    std::size_t capacity{}; // blocks carved from slabs so far
+    std::size_t slabs{}; // number of slab allocations (heap hits)
+    std::uint64_t allocs{}; // total allocate() calls served by this class
+  };
+
+  void* allocate(std::size_t size);
+  void deallocate(void* ptr, std::size_t size) noexcept;
+
+  // Stats for class 'index'; index == class_sizes.size() is the oversize bucket.
+  [[nodiscard]] const FrameClassStats& stats(std::size_t index) noexcept;
+  void print_stats();
+} // namespace test::frame_arena
+
+#endif // DUT_TOP_FRAMEARENA_HPP
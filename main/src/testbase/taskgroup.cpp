@@ -0,0 +1,115 @@
+// MIT License
+//
+// Copyright (c) 2024 Rovshan Rustamov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "testbase.hpp"
+
+namespace test {
+  namespace {
+    // Deepest task of a chain: the one suspended on a non-task awaitable
+    TestBase::RunUserTask::Handle leaf_of(TestBase::RunUserTask::Handle h) noexcept {
+      while (h.promise().child) {
+        h = h.promise().child;
+      }
+      return h;
+    }
+  } // namespace
+
+  TestBase::TaskGroup::~TaskGroup() {
+    cancel();
+
+    // Whatever could not stop yet unwinds later without us
+    for (const Child::Handle child : children_) {
+      child.promise().slot.group = nullptr;
+    }
+  }
+
+  TestBase::TaskGroup::Child TestBase::TaskGroup::run_child_(TaskGroup&, RunUserTask task) {
+    co_await task;
+  }
+
+  void TestBase::TaskGroup::spawn(const RunUserTask task) {
+    const Child child = run_child_(*this, task);
+    children_.push_back(child.handle);
+    child.handle.resume();
+  }
+
+  void TestBase::TaskGroup::cancel() noexcept {
+    std::coroutine_handle<> next{};
+
+    // Backwards, as unwinding a child swaps the last one into its place
+    for (std::size_t i = children_.size(); i-- > 0;) {
+      TaskSlot& slot = children_[i].promise().slot;
+      slot.cancel_requested = true;
+
+      const RunUserTask::Handle leaf = leaf_of(slot.top);
+      auto& promise = leaf.promise();
+      if (promise.cancel != nullptr && promise.cancel(promise.awaitable)) {
+        if (const std::coroutine_handle<> joiner = unwind_(slot)) {
+          next = joiner;
+        }
+      }
+    }
+
+    if (next) {
+      next.resume();
+    }
+  }
+
+  std::coroutine_handle<> TestBase::TaskGroup::unwind_(TaskSlot& slot) noexcept {
+    // Innermost frame first: a parent's frame may own what its child refers to
+    for (;;) {
+      RunUserTask::Handle parent{};
+      RunUserTask::Handle h = slot.top;
+      while (h.promise().child) {
+        parent = h;
+        h = h.promise().child;
+      }
+      h.destroy();
+      if (!parent) {
+        break;
+      }
+      parent.promise().child = nullptr;
+    }
+
+    // The slot lives in the wrapper frame
+    TaskGroup* group = slot.group;
+    const std::coroutine_handle<> wrapper = slot.wrapper;
+    wrapper.destroy();
+
+    return group ? group->finished_(wrapper) : nullptr;
+  }
+
+  std::coroutine_handle<> TestBase::TaskGroup::finished_(const std::coroutine_handle<> wrapper) noexcept {
+    for (std::size_t i = 0; i < children_.size(); ++i) {
+      if (children_[i].address() == wrapper.address()) {
+        children_[i] = children_.back();
+        children_.pop_back();
+        break;
+      }
+    }
+
+    if (!children_.empty() || !joiner_) {
+      return nullptr;
+    }
+    return std::exchange(joiner_, nullptr);
+  }
+} // namespace test
@@ -26,7 +26,100 @@
 #include "testbase.hpp"
 
 namespace test {
-  void TestBase::addNet(const std::string& key, const unsigned int length) {
+  namespace detail {
+    void resolve_net(t_netmap_value& entry) noexcept {
+      const vpiHandle scope = entry.scope;
+      entry.scope = nullptr; // a single attempt; failures stay unresolved
+
+      entry.vpi_handle = vpi_handle_by_name(const_cast<char*>(entry.name), scope);
+      if (entry.vpi_handle == nullptr) {
+        std::printf("[ERROR]\tvpi_handle_by_name failed for '%s' in DUT scope\n", entry.name);
+        return;
+      }
+
+      const PLI_INT32 size = vpi_get(vpiSize, entry.vpi_handle);
+      if (size > 0 && static_cast<unsigned int>(size) != entry.length) {
+        if (entry.length != 0) {
+          std::printf("[WARNING]\tNet '%s' declared with %u bits, vpiSize is %d; using vpiSize\n",
+                      entry.name, entry.length, static_cast<int>(size));
+        }
+        entry.length = static_cast<unsigned int>(size);
+      }
+#ifdef RAPIDVPI_DEBUG
+      std::printf("[DBG]\tResolved net '%s', handle=%p, len=%u\n",
+                  entry.name, static_cast<void*>(entry.vpi_handle), entry.length);
+#endif
+    }
+  } // namespace detail
+
+  vpiHandle TestBase::dutScope_() {
+    if (dut_scope_ != nullptr) {
+      return dut_scope_;
+    }
+
+    dut_scope_ = vpi_handle_by_name(const_cast<char*>(dutName.c_str()), nullptr);
+    if (dut_scope_ == nullptr) {
+      std::printf("[ERROR]\tvpi_handle_by_name failed for DUT scope '%s'\n", dutName.c_str());
+      return nullptr;
+    }
+
+    if (net_resolution_ == NetResolution::discover) {
+      // One walk over the scope; the iterator hands out resolved handles
+      for (const PLI_INT32 type : {vpiNet, vpiReg}) {
+        const vpiHandle iterator = vpi_iterate(type, dut_scope_);
+        if (iterator == nullptr) {
+          continue;
+        }
+
+        while (const vpiHandle h = vpi_scan(iterator)) {
+          const char* name = vpi_get_str(vpiName, h);
+          if (name == nullptr) {
+            continue;
+          }
+
+          t_netmap_value entry{};
+          entry.vpi_handle = h;
+          entry.length = static_cast<unsigned int>(vpi_get(vpiSize, h));
+          const auto [it, inserted] = netMap.try_emplace(name, entry);
+          if (inserted) {
+            it->second.name = it->first.c_str();
+            ++nets_discovered_;
+          }
+        }
+      }
+#ifdef RAPIDVPI_DEBUG
+      std::printf("[DBG]\tDiscovered %zu nets in DUT scope '%s'\n",
+                  nets_discovered_, dutName.c_str());
+#endif
+    }
+
+    return dut_scope_;
+  }
+
+  Net TestBase::addNet(const std::string& key, const unsigned int length) {
+    ++nets_declared_;
+
+    if (net_resolution_ != NetResolution::eager) {
+      const vpiHandle scope = dutScope_();
+
+      // Discovered nets are already resolved; only the width is checked
+      if (const auto found = netMap.find(key);
+        found != netMap.end() && found->second.vpi_handle != nullptr) {
+        if (length != 0 && found->second.length != length) {
+          std::printf("[WARNING]\tNet '%s' declared with %u bits, vpiSize is %u; using vpiSize\n",
+                      key.c_str(), length, found->second.length);
+        }
+        return Net{&found->second};
+      }
+
+      t_netmap_value entry{};
+      entry.length = length;
+      entry.scope = scope; // resolved on first use
+      const auto it = netMap.insert_or_assign(key, entry).first;
+      it->second.name = it->first.c_str();
+      return Net{&it->second};
+    }
+
     const std::string full_name = dutName + "." + key;
     vpiHandle h = vpi_handle_by_name(const_cast<char*>(full_name.c_str()), nullptr);
 
@@ -43,27 +136,89 @@ namespace test {
     t_netmap_value entry{};
     entry.vpi_handle = h;
     entry.length = length;
-    netMap[key] = entry;
+
+    // netMap nodes never move, so the Net may point at the stored entry
+    const auto it = netMap.insert_or_assign(key, entry).first;
+    it->second.name = it->first.c_str();
+    return Net{&it->second};
   }
 
-  vpiHandle TestBase::getNetHandle(const std::string& key) {
+  Net TestBase::addNet(const std::string& key) {
+    if (net_resolution_ == NetResolution::eager) {
+      std::printf("[ERROR]\taddNet: net '%s' needs a width unless lazy or discover resolution is set\n",
+                  key.c_str());
+      return Net{};
+    }
+    return addNet(key, 0);
+  }
+
+  Net TestBase::getNet(const std::string& key) {
+#ifdef RAPIDVPI_STATS
+    ++net_lookups_;
+#endif
     const auto it = netMap.find(key);
     if (it == netMap.end()) {
-      std::printf("[ERROR]\tgetNetHandle: key '%s' not found in netMap\n", key.c_str());
-      return nullptr;
+      // Outside eager mode any net of the DUT scope may be used undeclared
+      if (net_resolution_ != NetResolution::eager && dutScope_() != nullptr) {
+        if (const vpiHandle h = vpi_handle_by_name(const_cast<char*>(key.c_str()), dut_scope_);
+          h != nullptr) {
+          t_netmap_value entry{};
+          entry.vpi_handle = h;
+          entry.length = static_cast<unsigned int>(vpi_get(vpiSize, h));
+          const auto added = netMap.emplace(key, entry).first;
+          added->second.name = added->first.c_str();
+          return Net{&added->second};
+        }
+      }
+      std::printf("[ERROR]\tgetNet: key '%s' not found in netMap\n", key.c_str());
+      return Net{};
     }
-    if (it->second.vpi_handle == nullptr) {
-      std::printf("[ERROR]\tgetNetHandle: key '%s' has NULL vpi_handle\n", key.c_str());
+    if (it->second.scope == nullptr && it->second.vpi_handle == nullptr) {
+      std::printf("[ERROR]\tgetNet: key '%s' has NULL vpi_handle\n", key.c_str());
     }
-    return it->second.vpi_handle;
+    return Net{&it->second};
+  }
+
+  vpiHandle TestBase::getNetHandle(const std::string& key) {
+    return getNet(key).handle();
   }
 
   unsigned int TestBase::getNetLength(const std::string& key) {
-    const auto it = netMap.find(key);
-    if (it == netMap.end()) {
-      std::printf("[ERROR]\tgetNetLength: key '%s' not found in netMap\n", key.c_str());
-      return 0;
+    return getNet(key).length();
+  }
+
+  void TestBase::setNetFormat(const Net& net, const PLI_INT32 format) {
+    if (!net.valid()) {
+      return; // reported by the net lookup
+    }
+
+    const unsigned int length = net.length();
+    const bool fits = format == vpiVectorVal ||
+                      (format == vpiScalarVal && length == 1) ||
+                      (format == vpiIntVal && length <= 32);
+    if (!fits) {
+      std::printf("[WARNING]\tVPI format %d cannot hold net '%s' of %u bits, keeping the default\n",
+                  static_cast<int>(format), net.name(), length);
+      return;
     }
-    return it->second.length;
+
+    net.entry_->value_format = format;
+  }
+
+  std::size_t TestBase::netsResolved() const {
+    std::size_t resolved = 0;
+    for (const auto& [key, entry] : netMap) {
+      if (entry.vpi_handle != nullptr) {
+        ++resolved;
+      }
+    }
+    return resolved;
+  }
+
+  void TestBase::printNetStats() const {
+#ifdef RAPIDVPI_STATS
+    std::printf("[INFO]\tRapidVPI nets: registered=%zu resolved=%zu name_lookups=%llu\n",
+                netMap.size(), netsResolved(), net_lookups_);
+#endif
   }
 } // namespace test
@@ -24,7 +24,10 @@
 
 #include <string>
 #include <cmath>
+#include <algorithm>
+#include <array>
 #include <chrono>
+#include <concepts>
 #include <coroutine>
 #include <cstdint>
 #include <memory>
@@ -36,6 +39,8 @@
 #include <vector>
 #include <unordered_map>
 #include <functional>
+#include <initializer_list>
+#include <span>
 #include <cstdio>  // for printf / std::printf
 
 // VPI library
@@ -43,26 +48,51 @@
 
 #include "testmanager.hpp"
 #include "scheduler.hpp"
+#include "framearena.hpp"
+#include "bitvector.hpp"
+#include "awaitgroup.hpp"
+#include "vecvalcodec.hpp"
 
 namespace test {
-  typedef struct s_write_value {
-    std::string strValue;
-    unsigned long long ullValue;
-    PLI_INT32 flag; // Flag for forced write or regular no delay
-  } t_write_value;
-
   typedef struct s_netmap_value {
     unsigned int length; // net length in bits
     vpiHandle vpi_handle;
+    const char* name; // netMap key
+    vpiHandle scope; // DUT scope while resolution is pending, else nullptr
+    PLI_INT32 value_format; // read format set by TestBase::setNetFormat, 0 for the default
   } t_netmap_value;
 
+  // How TestBase::addNet turns a net name into a VPI handle
+  enum class NetResolution {
+    eager, // vpi_handle_by_name on the full path inside addNet
+    lazy, // resolve relative to the cached DUT scope on first use
+    discover // walk the DUT scope once; nets it misses resolve lazily
+  };
+
   typedef struct s_read_value {
-    std::string strValue;
+    std::string strValue; // binary string, built on first getBinStr (empty until then)
     std::vector<unsigned int> uintValues;
+    std::vector<s_vpi_vecval> vecval; // raw value words, LS chunk first
   } t_read_value;
 
   using sim_tick_t = std::uint64_t;
 
+  namespace detail {
+    // Resolve a lazily registered net in place (see NetResolution::lazy)
+    void resolve_net(t_netmap_value& entry) noexcept;
+
+    // Cheapest VPI format that still returns the whole four-state value:
+    // vpiScalarVal for 1 bit and vpiVectorVal above that. vpiIntVal drops
+    // x/z, so nets of up to 32 bits only use it after setNetFormat.
+    [[nodiscard]] constexpr PLI_INT32 default_value_format(const unsigned int length) noexcept {
+      return length == 1 ? vpiScalarVal : vpiVectorVal;
+    }
+
+    // Binary string of a read/change value, built from its vecval words on
+    // first use so resumes that only need getNum never format one
+    const std::string& bin_str(t_read_value& value);
+  } // namespace detail
+
   enum class TimeUnit {
     ticks,
     ps,
@@ -116,6 +146,52 @@ namespace test {
   template <TimeUnit U>
   using delay_arg_t = time_value_t<U>;
 
+  [[nodiscard]] constexpr int time_unit_exp10(const TimeUnit unit) noexcept {
+    switch (unit) {
+    case TimeUnit::ms: return -3;
+    case TimeUnit::us: return -6;
+    case TimeUnit::ns: return -9;
+    case TimeUnit::ps: return -12;
+    default: return 0;
+    }
+  }
+
+  // Time literals: 10_ns is exact, 2.5_us keeps its fraction. Both are
+  // std::chrono durations, so getCoWrite/getCoRead/setDelay take them directly.
+  inline namespace literals {
+    constexpr std::chrono::duration<long long, std::pico> operator""_ps(const unsigned long long v) {
+      return std::chrono::duration<long long, std::pico>(static_cast<long long>(v));
+    }
+
+    constexpr std::chrono::duration<double, std::pico> operator""_ps(const long double v) {
+      return std::chrono::duration<double, std::pico>(static_cast<double>(v));
+    }
+
+    constexpr std::chrono::nanoseconds operator""_ns(const unsigned long long v) {
+      return std::chrono::nanoseconds(static_cast<long long>(v));
+    }
+
+    constexpr std::chrono::duration<double, std::nano> operator""_ns(const long double v) {
+      return std::chrono::duration<double, std::nano>(static_cast<double>(v));
+    }
+
+    constexpr std::chrono::microseconds operator""_us(const unsigned long long v) {
+      return std::chrono::microseconds(static_cast<long long>(v));
+    }
+
+    constexpr std::chrono::duration<double, std::micro> operator""_us(const long double v) {
+      return std::chrono::duration<double, std::micro>(static_cast<double>(v));
+    }
+
+    constexpr std::chrono::milliseconds operator""_ms(const unsigned long long v) {
+      return std::chrono::milliseconds(static_cast<long long>(v));
+    }
+
+    constexpr std::chrono::duration<double, std::milli> operator""_ms(const long double v) {
+      return std::chrono::duration<double, std::milli>(static_cast<double>(v));
+    }
+  } // namespace literals
+
   namespace detail {
     [[nodiscard]] inline sim_tick_t vpi_time_to_ticks(const s_vpi_time& time) noexcept {
       const auto high = static_cast<std::uint32_t>(time.high);
@@ -135,6 +211,48 @@ namespace test {
       time.low = static_cast<PLI_UINT32>(low);
     }
 
+    // 10^0 .. 10^19: every gap between a time unit and a VPI precision in use
+    inline constexpr std::array<std::uint64_t, 20> pow10_u64 = [] {
+      std::array<std::uint64_t, 20> table{};
+      std::uint64_t value = 1;
+      for (auto& entry : table) {
+        entry = value;
+        value *= 10u;
+      }
+      return table;
+    }();
+
+    [[nodiscard]] constexpr long double pow10_ld(const int exp10) noexcept {
+      long double value = 1.0L;
+      for (int i = 0; i < (exp10 < 0 ? -exp10 : exp10); ++i) {
+        value *= 10.0L;
+      }
+      return exp10 < 0 ? 1.0L / value : value;
+    }
+
+    // Raw VPI ticks per time unit as an exact ratio (one of mul/div is 1);
+    // mul == 0 marks a gap past 10^19, which only the scale can express
+    struct TickRatio {
+      std::uint64_t mul{0};
+      std::uint64_t div{0};
+      long double scale{0.0L}; // mul / div, for fractional delays
+    };
+
+    [[nodiscard]] constexpr TickRatio make_tick_ratio(const int unit_exp10,
+                                                      const int precision_exp10) noexcept {
+      const int gap = unit_exp10 - precision_exp10;
+      if (gap >= 0 && gap < static_cast<int>(pow10_u64.size())) {
+        return {pow10_u64[gap], 1, static_cast<long double>(pow10_u64[gap])};
+      }
+      if (gap < 0 && -gap < static_cast<int>(pow10_u64.size())) {
+        return {1, pow10_u64[-gap], pow10_ld(gap)};
+      }
+      return {0, 0, pow10_ld(gap)};
+    }
+
+    static_assert(make_tick_ratio(time_unit_exp10(TimeUnit::ns), -12).mul == 1000);
+    static_assert(make_tick_ratio(time_unit_exp10(TimeUnit::ps), -9).div == 1000);
+
     [[nodiscard]] inline sim_tick_t current_vpi_time_ticks() noexcept {
       s_vpi_time time{};
       time.type = vpiSimTime;
@@ -143,6 +261,177 @@ namespace test {
     }
   } // namespace detail
 
+  class TestBase;
+
+  /**
+   * @class Net
+   *
+   * @brief Interned DUT net returned by TestBase::addNet.
+   *
+   * Carries the resolved VPI handle and bit width, so awaitables given a Net
+   * skip the netMap string lookup. Copy it freely; it stays valid for the
+   * lifetime of the TestBase that registered it.
+   */
+  class Net {
+  public:
+    Net() = default;
+
+    [[nodiscard]] vpiHandle handle() const noexcept {
+      return resolved_() != nullptr ? entry_->vpi_handle : nullptr;
+    }
+
+    [[nodiscard]] unsigned int length() const noexcept {
+      return resolved_() != nullptr ? entry_->length : 0;
+    }
+
+    [[nodiscard]] const char* name() const noexcept {
+      return entry_ != nullptr ? entry_->name : "(unknown)";
+    }
+
+    // VPI format reads and change handlers use for this net
+    [[nodiscard]] PLI_INT32 format() const noexcept {
+      const t_netmap_value* entry = resolved_();
+      if (entry == nullptr) {
+        return vpiVectorVal;
+      }
+      return entry->value_format != 0 ? entry->value_format : detail::default_value_format(entry->length);
+    }
+
+    // False for nets which were never registered or failed to resolve
+    [[nodiscard]] bool valid() const noexcept { return handle() != nullptr; }
+    explicit operator bool() const noexcept { return valid(); }
+
+    friend bool operator==(const Net& lhs, const Net& rhs) noexcept {
+      return lhs.entry_ == rhs.entry_;
+    }
+
+  private:
+    friend class TestBase;
+
+    explicit Net(t_netmap_value* entry)
+      : entry_(entry) {
+    }
+
+    const t_netmap_value* resolved_() const noexcept {
+      if (entry_ != nullptr && entry_->scope != nullptr) {
+        detail::resolve_net(*entry_);
+      }
+      return entry_;
+    }
+
+    t_netmap_value* entry_{nullptr}; // owned by TestBase::netMap, nodes never move
+  };
+
+  // Narrowest unsigned type holding a 'Width'-bit net value. Numeric access is
+  // limited to 64 bits; wider nets go through the string API.
+  template <unsigned int Width>
+  using net_value_t =
+    std::conditional_t<Width == 1, bool,
+    std::conditional_t<Width <= 8, std::uint8_t,
+    std::conditional_t<Width <= 16, std::uint16_t,
+    std::conditional_t<Width <= 32, std::uint32_t, std::uint64_t>>>>;
+
+  /**
+   * @class NetValue
+   *
+   * @brief Value written to a TypedNet.
+   *
+   * Integer constants are range-checked against 'Width' while compiling.
+   * Runtime values must already have the net's value type, so any narrowing
+   * is explicit at the call site.
+   */
+  template <unsigned int Width>
+  class NetValue {
+  public:
+    using value_type = net_value_t<Width>;
+
+    consteval NetValue(const unsigned long long int value)
+      : value_(static_cast<value_type>(value)) {
+      if constexpr (Width < 64) {
+        if ((value >> Width) != 0) {
+          throw std::out_of_range("RapidVPI constant does not fit the net width");
+        }
+      }
+    }
+
+    template <typename T>
+      requires std::same_as<T, value_type>
+    constexpr NetValue(const T value) noexcept
+      : value_(value) {
+    }
+
+    [[nodiscard]] constexpr value_type get() const noexcept { return value_; }
+
+  private:
+    value_type value_;
+  };
+
+  /**
+   * @class TypedNet
+   *
+   * @brief Net descriptor with a compile-time width.
+   *
+   * Declared once, constant-initialized, next to the other pin definitions:
+   *
+   *   inline constinit TypedNet<BYTE_W> tx_byte_data{"tx_byte_data"};
+   *
+   * TestBase::addNet(net) registers it under its name and caches the resolved
+   * Net inside it. Reads return net_value_t<Width>, constant writes are
+   * range-checked and the vecval chunk count is a constant.
+   */
+  template <unsigned int Width>
+  class TypedNet {
+    static_assert(Width > 0, "TypedNet width must be at least one bit");
+
+  public:
+    using value_type = net_value_t<Width>;
+
+    static constexpr unsigned int width = Width;
+    static constexpr unsigned int vecval_len = (Width + 31) / 32;
+    static constexpr std::uint64_t mask =
+      Width >= 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << (Width % 64)) - 1;
+
+    constexpr explicit TypedNet(const char* name) noexcept
+      : name_(name) {
+    }
+
+    [[nodiscard]] constexpr const char* name() const noexcept { return name_; }
+    [[nodiscard]] const Net& net() const noexcept { return net_; }
+
+  private:
+    friend class TestBase;
+
+    const char* name_;
+    Net net_{}; // filled in by TestBase::addNet
+  };
+
+  // One transition of TestBase::scheduleWaveform(): 'value' is driven
+  // 'delta_ticks' after the previous transition (the first counts from now)
+  struct WaveStep {
+    sim_tick_t delta_ticks;
+    unsigned long long int value;
+  };
+
+  // Condition of a predicate AwaitChange; gets the net value as getNum() would
+  using ChangePredicate = std::function<bool(unsigned long long int)>;
+
+  // Condition of an AwaitWatch; gets one value per watched net, in order
+  using WatchPredicate = std::function<bool(std::span<const unsigned long long int>)>;
+
+  namespace detail {
+    // Append a per-net operation unless the net already has one queued; the
+    // first request for a net wins, as with the former map insert().
+    template <typename T>
+    void insert_net_op(std::vector<std::pair<Net, T>>& ops, const Net& net, T&& op) {
+      for (const auto& entry : ops) {
+        if (entry.first == net) {
+          return;
+        }
+      }
+      ops.emplace_back(net, std::move(op));
+    }
+  } // namespace detail
+
   /**
    * @class TestBase
    *
@@ -168,7 +457,11 @@ namespace test {
     // Function for updating effective VPI simulator time precision
     void updateVpiTimePrecision(const int precision_exp10) {
       vpi_time_precision_exp10_ = precision_exp10;
-      vpi_tick_period_s_ = std::pow(10.0L, static_cast<long double>(precision_exp10));
+      vpi_tick_period_s_ = detail::pow10_ld(precision_exp10);
+      for (const TimeUnit unit : {TimeUnit::ps, TimeUnit::ns, TimeUnit::us, TimeUnit::ms}) {
+        tick_ratios_[static_cast<std::size_t>(unit)] =
+          detail::make_tick_ratio(time_unit_exp10(unit), precision_exp10);
+      }
     }
 
     [[nodiscard]] int vpiTimePrecisionExp10() const noexcept {
@@ -179,10 +472,56 @@ namespace test {
       return vpi_tick_period_s_;
     }
 
+    // Delay in unit U to raw ticks, rounded up to a whole tick
+    template <TimeUnit U>
+    [[nodiscard]] sim_tick_t toTicks(const delay_arg_t<U> delay) const {
+      return delay_to_ticks_<U>(delay);
+    }
+
+    template <typename Rep, typename Period>
+    [[nodiscard]] sim_tick_t toTicks(std::chrono::duration<Rep, Period> delay) const;
+
+    // Raw ticks to unit U
+    template <TimeUnit U>
+    [[nodiscard]] time_value_t<U> fromTicks(const sim_tick_t tick_count) const {
+      return ticks_to_time_<U>(tick_count);
+    }
+
+    // Select how addNet resolves names; call before the first addNet
+    void setNetResolution(const NetResolution mode) {
+      net_resolution_ = mode;
+    }
+
+    [[nodiscard]] NetResolution netResolution() const noexcept {
+      return net_resolution_;
+    }
+
     // Net operations
-    void addNet(const std::string& key, unsigned int length); // add net to netMap
+    Net addNet(const std::string& key, unsigned int length); // add net to netMap
+    Net addNet(const std::string& key); // width from vpiSize; lazy/discover only
+    Net getNet(const std::string& key); // look up a registered net by name
     vpiHandle getNetHandle(const std::string& key); // get vpi handle of given net
     unsigned int getNetLength(const std::string& key); // get bit length of given net
+    void printNetStats() const; // netMap size and string lookup count
+
+    // Read 'net' with another VPI format than the width-based default, e.g.
+    // vpiIntVal for a net of up to 32 bits whose x/z state nobody checks
+    void setNetFormat(const Net& net, PLI_INT32 format);
+
+    void setNetFormat(const std::string& key, const PLI_INT32 format) {
+      setNetFormat(getNet(key), format);
+    }
+
+    [[nodiscard]] std::size_t netsDeclared() const noexcept { return nets_declared_; }
+    [[nodiscard]] std::size_t netsDiscovered() const noexcept { return nets_discovered_; }
+    [[nodiscard]] std::size_t netsResolved() const; // entries holding a VPI handle
+
+    // Register a typed net under its own name and width and cache its handle
+    template <unsigned int Width>
+    const TypedNet<Width>& addNet(TypedNet<Width>& net) {
+      net.net_ = addNet(net.name_, Width);
+      return net;
+    }
 
     // Auxiliary operations
     static char bin_to_hex_char(const std::string& bin);
@@ -199,7 +538,10 @@ namespace test {
         : cb_handle(nullptr)
           , parent(parentRef)
           , delay_ticks(delay_ticks)
-          , grouped_writes()
+          , inline_ops()
+          , op_count(0)
+          , spill_ops()
+          , wide_vecvals()
           , handle(nullptr) {
       }
 
@@ -208,20 +550,98 @@ namespace test {
       void await_suspend(std::coroutine_handle<> h);
       void await_resume() noexcept;
 
-      // adds write operation to grouped_writes; parameter is uint64
-      void write(const std::string& netStr, unsigned long long int value);
+      // Withdraw a pending wait; false if it already fired. A cancelled
+      // delayed write puts nothing, zero-delay writes are already staged.
+      bool cancel() noexcept;
+
+      // adds write operation to the write list; parameter is uint64
+      void write(const Net& net, unsigned long long int value);
+
+      // adds force operation to the write list; parameter is uint64
+      void force(const Net& net, unsigned long long int value);
 
-      // adds force operation to grouped_writes; parameter is uint64
-      void force(const std::string& netStr, unsigned long long int value);
+      // adds force-release operation to the write list
+      void release(const Net& net);
 
-      // adds force-release operation to grouped_writes
-      void release(const std::string& netStr);
+      // adds write operation to the write list; parameter is string
+      void write(const Net& net, const std::string& valStr, unsigned int base = 2);
+
+      // adds force operation to the write list; parameter is string
+      void force(const Net& net, const std::string& valStr, unsigned int base = 2);
+
+      // adds write/force operation to the write list; four-state value,
+      // zero-extended or truncated to the net width
+      void write(const Net& net, const BitVector& value);
+      void force(const Net& net, const BitVector& value);
+
+      // Name-keyed shims; resolve the net through TestBase::getNet and forward
+      void write(const std::string& netStr, unsigned long long int value) {
+        write(parent.getNet(netStr), value);
+      }
+
+      void force(const std::string& netStr, unsigned long long int value) {
+        force(parent.getNet(netStr), value);
+      }
+
+      void release(const std::string& netStr) {
+        release(parent.getNet(netStr));
+      }
+
+      void write(const std::string& netStr, const std::string& valStr, unsigned int base = 2) {
+        write(parent.getNet(netStr), valStr, base);
+      }
+
+      void force(const std::string& netStr, const std::string& valStr, unsigned int base = 2) {
+        force(parent.getNet(netStr), valStr, base);
+      }
+
+      void write(const std::string& netStr, const BitVector& value) {
+        write(parent.getNet(netStr), value);
+      }
+
+      void force(const std::string& netStr, const BitVector& value) {
+        force(parent.getNet(netStr), value);
+      }
+
+      // Typed nets; constant values are range-checked at compile time. The
+      // string overloads exclude integers so a literal 0 is not taken as a
+      // null string pointer.
+      template <unsigned int Width>
+      void write(const TypedNet<Width>& net, const std::type_identity_t<NetValue<Width>> value) {
+        write(net.net(), static_cast<unsigned long long int>(value.get()));
+      }
+
+      template <unsigned int Width>
+      void force(const TypedNet<Width>& net, const std::type_identity_t<NetValue<Width>> value) {
+        force(net.net(), static_cast<unsigned long long int>(value.get()));
+      }
+
+      template <unsigned int Width>
+      void release(const TypedNet<Width>& net) {
+        release(net.net());
+      }
+
+      template <unsigned int Width, typename S>
+        requires std::convertible_to<const S&, std::string> && (!std::integral<S>)
+      void write(const TypedNet<Width>& net, const S& valStr, unsigned int base = 2) {
+        write(net.net(), std::string(valStr), base);
+      }
+
+      template <unsigned int Width, typename S>
+        requires std::convertible_to<const S&, std::string> && (!std::integral<S>)
+      void force(const TypedNet<Width>& net, const S& valStr, unsigned int base = 2) {
+        force(net.net(), std::string(valStr), base);
+      }
 
-      // adds write operation to grouped_writes; parameter is string
-      void write(const std::string& netStr, const std::string& valStr, unsigned int base = 2);
+      template <unsigned int Width>
+      void write(const TypedNet<Width>& net, const BitVector& value) {
+        write(net.net(), value);
+      }
 
-      // adds force operation to grouped_writes; parameter is string
-      void force(const std::string& netStr, const std::string& valStr, unsigned int base = 2);
+      template <unsigned int Width>
+      void force(const TypedNet<Width>& net, const BitVector& value) {
+        force(net.net(), value);
+      }
 
       void setDelay() {
         delay_ticks = 0;
@@ -230,11 +650,70 @@ namespace test {
       template <TimeUnit U>
       void setDelay(delay_arg_t<U> delay);
 
+      template <typename Rep, typename Period>
+      void setDelay(const std::chrono::duration<Rep, Period> delay) {
+        delay_ticks = parent.toTicks(delay);
+      }
+
     private:
       vpiHandle cb_handle; // handle for a callback
       TestBase& parent; // reference to the DUT test object of Test class
       sim_tick_t delay_ticks; // raw simulator tick delay
-      std::unordered_map<std::string, t_write_value> grouped_writes; // write ops
+      // One pending put. Values of up to 64 bits are packed in place, wider
+      // ones into wide_vecvals.
+      struct WriteOp {
+        Net net;
+        PLI_INT32 flag; // vpiNoDelay, vpiForceFlag or vpiReleaseFlag
+        unsigned int vecval_len; // number of 32-bit chunks
+        std::size_t wide_offset; // first chunk in wide_vecvals if vecval_len > 2
+        s_vpi_vecval inline_vecval[2];
+      };
+
+      static constexpr std::size_t inline_writes = 4;
+
+      WriteOp& op(std::size_t index);
+      s_vpi_vecval* opVecval(WriteOp& write_op);
+      s_vpi_vecval* addOp(const Net& net, PLI_INT32 flag); // zeroed chunks, or null
+      void clearOps();
+
+      // Write list, in request order. The first inline_writes ops live in the
+      // awaitable itself, so typical writes never touch the heap; the spill
+      // and wide-value vectors keep their capacity across awaits.
+      std::array<WriteOp, inline_writes> inline_ops;
+      std::size_t op_count;
+      std::vector<WriteOp> spill_ops;
+      std::vector<s_vpi_vecval> wide_vecvals;
+      std::coroutine_handle<> handle; // coroutine handle
+    };
+
+    // ============================================================
+    // AwaitWaveform
+    // ============================================================
+    // Returned by scheduleWaveform(); resumes in the time step of the last
+    // transition, however late it is awaited (at once if that has passed)
+    class AwaitWaveform {
+    public:
+      explicit AwaitWaveform(const sim_tick_t end_ticks)
+        : end_ticks(end_ticks) {
+      }
+
+      bool await_ready() const noexcept {
+        return detail::current_vpi_time_ticks() > end_ticks;
+      }
+
+      void await_suspend(std::coroutine_handle<> h);
+
+      void await_resume() const noexcept {
+      }
+
+      // Withdraw the wait for the last transition; the transitions stay scheduled
+      bool cancel() noexcept;
+
+      // Absolute tick of the last transition
+      [[nodiscard]] sim_tick_t endTicks() const noexcept { return end_ticks; }
+
+    private:
+      sim_tick_t end_ticks;
       std::coroutine_handle<> handle; // coroutine handle
     };
 
@@ -254,18 +733,67 @@ namespace test {
       }
 
       // adds read operation to grouped_reads
-      void read(const std::string& netStr);
+      void read(const Net& net);
+
+      unsigned long long int getNum(const Net& net);
 
-      unsigned long long int getNum(const std::string& netStr);
+      std::string getBinStr(const Net& net); // For binary value string
+      std::string getHexStr(const Net& net); // For hex value string
+      BitVector getBits(const Net& net); // Four-state value, any width
 
-      std::string getBinStr(const std::string& netStr); // For binary value string
-      std::string getHexStr(const std::string& netStr); // For hex value string
+      // Name-keyed shims; resolve the net through TestBase::getNet and forward
+      void read(const std::string& netStr) {
+        read(parent.getNet(netStr));
+      }
+
+      unsigned long long int getNum(const std::string& netStr) {
+        return getNum(parent.getNet(netStr));
+      }
+
+      std::string getBinStr(const std::string& netStr) {
+        return getBinStr(parent.getNet(netStr));
+      }
+
+      std::string getHexStr(const std::string& netStr) {
+        return getHexStr(parent.getNet(netStr));
+      }
+
+      BitVector getBits(const std::string& netStr) {
+        return getBits(parent.getNet(netStr));
+      }
+
+      // Typed nets; getNum returns the narrowest type holding the net
+      template <unsigned int Width>
+      void read(const TypedNet<Width>& net) {
+        read(net.net());
+      }
+
+      template <unsigned int Width>
+      net_value_t<Width> getNum(const TypedNet<Width>& net);
+
+      template <unsigned int Width>
+      std::string getBinStr(const TypedNet<Width>& net) {
+        return getBinStr(net.net());
+      }
+
+      template <unsigned int Width>
+      std::string getHexStr(const TypedNet<Width>& net) {
+        return getHexStr(net.net());
+      }
+
+      template <unsigned int Width>
+      BitVector getBits(const TypedNet<Width>& net) {
+        return getBits(net.net());
+      }
 
       // Coroutine service functions
       bool await_ready() const noexcept { return false; }
       void await_suspend(std::coroutine_handle<> h);
       void await_resume() noexcept;
 
+      // Withdraw a pending read; false if it already fired
+      bool cancel() noexcept;
+
       void setDelay() {
         delay_ticks = 0;
       }
@@ -273,15 +801,21 @@ namespace test {
       template <TimeUnit U>
       void setDelay(delay_arg_t<U> delay);
 
+      template <typename Rep, typename Period>
+      void setDelay(const std::chrono::duration<Rep, Period> delay) {
+        delay_ticks = parent.toTicks(delay);
+      }
+
       template <TimeUnit U>
       time_value_t<U> getTime() const;
 
     private:
       vpiHandle cb_handle; // handle for a callback
-      std::string getStr(const std::string& netStr, unsigned int base = 2);
+      std::string getStr(const Net& net, unsigned int base = 2);
+      t_read_value* findRead(const Net& net);
       TestBase& parent; // reference to the DUT test object of Test class
       sim_tick_t delay_ticks; // raw simulator tick delay
-      std::unordered_map<std::string, t_read_value> grouped_reads; // read ops
+      std::vector<std::pair<Net, t_read_value>> grouped_reads; // read ops, in request order
       sim_tick_t resume_time_ticks; // current read simulation time in raw ticks
       std::coroutine_handle<> handle; // coroutine handle
     };
@@ -292,10 +826,11 @@ namespace test {
     class AwaitChange {
     public:
       // Main constructor. Gets reference to base class and net monitored for change
-      AwaitChange(TestBase& parentRef, std::string net)
+      AwaitChange(TestBase& parentRef, const Net& net)
         : parent(parentRef)
-          , net(std::move(net))
+          , net(net)
           , change_target_value(0)
+          , change_target_bits()
           , change_is_targeted(false)
           , rd_change_value()
           , cb_handle(nullptr)
@@ -304,10 +839,11 @@ namespace test {
       }
 
       // Targeted change constructor
-      AwaitChange(TestBase& parentRef, std::string net, unsigned long long int target_value)
+      AwaitChange(TestBase& parentRef, const Net& net, unsigned long long int target_value)
         : parent(parentRef)
-          , net(std::move(net))
+          , net(net)
           , change_target_value(target_value)
+          , change_target_bits()
           , change_is_targeted(true)
           , rd_change_value()
           , cb_handle(nullptr)
@@ -317,33 +853,131 @@ namespace test {
         rd_change_value.uintValues.clear();
       }
 
+      // Four-state targeted change; every aval/bval bit of the net must match
+      AwaitChange(TestBase& parentRef, const Net& net, BitVector target_bits)
+        : parent(parentRef)
+          , net(net)
+          , change_target_value(0)
+          , change_target_bits(std::move(target_bits))
+          , change_is_targeted(true)
+          , rd_change_value()
+          , cb_handle(nullptr)
+          , resume_time_ticks(0)
+          , handle(nullptr) {
+      }
+
+      // Masked change: only the bits set in 'target_mask' are compared
+      AwaitChange(TestBase& parentRef, const Net& net, unsigned long long int target_mask,
+                  unsigned long long int target_value)
+        : parent(parentRef)
+          , net(net)
+          , change_target_value(target_value)
+          , change_target_mask(target_mask)
+          , change_target_bits()
+          , change_is_targeted(true)
+          , change_check_ready(true)
+          , rd_change_value()
+          , cb_handle(nullptr)
+          , resume_time_ticks(0)
+          , handle(nullptr) {
+      }
+
+      // Predicate change: resumes once 'predicate' accepts the net's value
+      AwaitChange(TestBase& parentRef, const Net& net, ChangePredicate predicate)
+        : parent(parentRef)
+          , net(net)
+          , change_target_value(0)
+          , change_target_bits()
+          , change_predicate(std::move(predicate))
+          , change_is_targeted(true)
+          , change_check_ready(true)
+          , rd_change_value()
+          , cb_handle(nullptr)
+          , resume_time_ticks(0)
+          , handle(nullptr) {
+      }
+
       template <TimeUnit U>
       time_value_t<U> getTime() const;
 
       // Coroutine service functions
-      bool await_ready() const noexcept { return false; }
+      bool await_ready() const noexcept;
       void await_suspend(std::coroutine_handle<> h);
       void await_resume() noexcept;
 
+      // Withdraw a pending wait; false if the change already fired
+      bool cancel() noexcept;
+
       unsigned long long int getNum();
       std::string getBinStr();
       std::string getHexStr();
+      BitVector getBits();
 
     private:
       std::string getStr(unsigned int base);
       TestBase& parent; // reference to the DUT test object of Test class
-      std::string net; // net name for monitored change
+      Net net; // net monitored for change
       unsigned long long int change_target_value; // target value for monitored change
+      unsigned long long int change_target_mask = ~0ULL; // bits of the target that are compared
+      BitVector change_target_bits; // four-state target; used instead when non-empty
+      ChangePredicate change_predicate; // condition used instead of the target when set
 
       // flag telling whether or not the change monitoring is looking for certain target
       bool change_is_targeted;
+      // masked and predicate waits complete at once if the condition already holds
+      bool change_check_ready = false;
       t_read_value rd_change_value; // holds the change value being read
 
       vpiHandle cb_handle; // handle for a callback for cbValueChange
+      scheduler::ChangeCallbackData* cb_record = nullptr; // pooled record while cb_handle is armed
+      int hub_edge = -1; // edge waited on through the edge hub, or -1
       sim_tick_t resume_time_ticks; // current change simulation time in raw ticks
       std::coroutine_handle<> handle; // coroutine handle
     };
 
+    // ============================================================
+    // AwaitWatch
+    // ============================================================
+    // Waits on several nets at once: resumes once 'predicate' accepts their
+    // values (one per net, in order, read as getNum() reads them). Changes
+    // only mark the watch dirty; the predicate runs once per time step on
+    // settled values, so the coroutine resumes on a match only.
+    class AwaitWatch {
+    public:
+      AwaitWatch(TestBase& parentRef, std::vector<Net> nets, WatchPredicate predicate)
+        : parent(parentRef)
+          , nets(std::move(nets))
+          , predicate(std::move(predicate))
+          , values(this->nets.size(), 0) {
+      }
+
+      // The predicate is checked once before suspending
+      bool await_ready();
+      void await_suspend(std::coroutine_handle<> h);
+      void await_resume() noexcept;
+
+      // Withdraw a pending watch; false if it already matched
+      bool cancel() noexcept;
+
+      // Value of nets[index] when the predicate matched
+      [[nodiscard]] unsigned long long int getNum(std::size_t index) const {
+        return values.at(index);
+      }
+
+      template <TimeUnit U>
+      time_value_t<U> getTime() const;
+
+    private:
+      bool check_(); // read every net into 'values' and apply the predicate
+
+      TestBase& parent; // reference to the DUT test object of Test class
+      std::vector<Net> nets; // watched nets, in predicate order
+      WatchPredicate predicate;
+      std::vector<unsigned long long int> values; // latest value of each net
+      scheduler::WatchSet watch; // callbacks, while suspended
+      sim_tick_t resume_time_ticks = 0; // match simulation time in raw ticks
+    };
+
     // ============================================================
     // RunTask  (top-level test coroutines)
     // ============================================================
@@ -353,6 +987,15 @@ namespace test {
 
         TestBase* test_instance{nullptr};
 
+        // Frames come from the size-class arena (see framearena.hpp)
+        static void* operator new(std::size_t size) {
+          return frame_arena::allocate(size);
+        }
+
+        static void operator delete(void* ptr, std::size_t size) noexcept {
+          frame_arena::deallocate(ptr, size);
+        }
+
         RunTask get_return_object() {
           return RunTask{Handle::from_promise(*this)};
         }
@@ -395,6 +1038,9 @@ namespace test {
       ~RunTask() = default; // non-owning wrapper; coroutine self-destroys
     };
 
+    struct TaskSlot;
+    class TaskGroup;
+
     // ============================================================
     // RunUserTask  (nested user coroutines: delay_ns, clock, etc.)
     // ============================================================
@@ -405,6 +1051,24 @@ namespace test {
         // Parent coroutine to resume when this child finishes
         std::coroutine_handle<> parentHandle{};
 
+        // What this task is suspended on, so a TaskGroup can unwind it: the
+        // child task it awaits, or an awaitable it can cancel. 'slot' is set
+        // for every task of a TaskGroup child's await chain.
+        TaskSlot* slot{};
+        Handle child{};
+        void* awaitable{};
+        bool (*cancel)(void* awaitable){};
+
+        // Helper coroutines are created once per clock/bit; recycle their
+        // frames through the size-class arena instead of the global heap
+        static void* operator new(std::size_t size) {
+          return frame_arena::allocate(size);
+        }
+
+        static void operator delete(void* ptr, std::size_t size) noexcept {
+          frame_arena::deallocate(ptr, size);
+        }
+
         // Create the coroutine object
         RunUserTask get_return_object() {
           return RunUserTask{Handle::from_promise(*this)};
@@ -415,20 +1079,21 @@ namespace test {
           return {};
         }
 
-        // On completion: resume parent, then destroy child frame
+        // On completion: transfer control straight back to the parent
+        // (symmetric transfer), so arbitrarily long await chains run in
+        // constant native stack. The parent's co_await reclaims this frame.
         auto final_suspend() noexcept {
           struct FinalAwaiter {
             bool await_ready() const noexcept { return false; }
 
-            void await_suspend(Handle h) noexcept {
-              auto& promise = h.promise();
-
-              if (promise.parentHandle) {
-                promise.parentHandle.resume();
+            std::coroutine_handle<> await_suspend(Handle h) noexcept {
+              if (const std::coroutine_handle<> parent = h.promise().parentHandle) {
+                return parent;
               }
 
-              // Child coroutine owns itself and destroys its frame here
+              // Nobody awaits this child; it owns itself and frees its frame here
               h.destroy();
+              return std::noop_coroutine();
             }
 
             void await_resume() noexcept {
@@ -441,6 +1106,75 @@ namespace test {
         }
 
         void unhandled_exception() { std::terminate(); }
+
+        template <typename T>
+        static decltype(auto) awaiter_of(T& awaitable) noexcept {
+          if constexpr (requires { awaitable.operator co_await(); }) {
+            return awaitable.operator co_await();
+          }
+          else {
+            return (awaitable);
+          }
+        }
+
+        // Wraps every co_await of the task body to record what it waits on.
+        // The awaitable itself is a temporary of the co_await expression (or
+        // a named object), so it outlives the suspension.
+        template <typename T>
+        struct Tracked {
+          promise_type& promise;
+          T& awaitable;
+          decltype(awaiter_of(std::declval<T&>())) awaiter;
+
+          bool await_ready() {
+            return awaiter.await_ready();
+          }
+
+          std::coroutine_handle<> await_suspend(std::coroutine_handle<> h) {
+            if (promise.slot != nullptr && promise.slot->cancel_requested) {
+              // Cancelled while running: stop here instead of waiting
+              if constexpr (std::same_as<T, RunUserTask>) {
+                awaitable.handle.destroy(); // never started
+              }
+              const std::coroutine_handle<> next = TaskGroup::unwind_(*promise.slot);
+              return next ? next : std::noop_coroutine();
+            }
+
+            if constexpr (std::same_as<T, RunUserTask>) {
+              awaitable.handle.promise().slot = promise.slot;
+              promise.child = awaitable.handle;
+            }
+            else if constexpr (CancellableAwaitable<T>) {
+              promise.awaitable = &awaitable;
+              promise.cancel = [](void* a) { return static_cast<T*>(a)->cancel(); };
+            }
+
+            using Result = decltype(awaiter.await_suspend(h));
+            if constexpr (std::is_void_v<Result>) {
+              awaiter.await_suspend(h);
+              return std::noop_coroutine();
+            }
+            else if constexpr (std::same_as<Result, bool>) {
+              return awaiter.await_suspend(h) ? std::noop_coroutine() : h;
+            }
+            else {
+              return awaiter.await_suspend(h);
+            }
+          }
+
+          decltype(auto) await_resume() {
+            promise.child = nullptr;
+            promise.awaitable = nullptr;
+            promise.cancel = nullptr;
+            return awaiter.await_resume();
+          }
+        };
+
+        template <typename A>
+        auto await_transform(A&& awaitable) noexcept {
+          using T = std::remove_reference_t<A>;
+          return Tracked<T>{*this, awaitable, awaiter_of(awaitable)};
+        }
       };
 
       using Handle = std::coroutine_handle<promise_type>;
@@ -452,7 +1186,8 @@ namespace test {
         }
       }
 
-      // Non-owning: do NOT call destroy() here; child destroys itself in final_suspend.
+      // Non-owning: do NOT call destroy() here; the awaiting parent destroys
+      // the finished child in Awaiter::await_resume.
       ~RunUserTask() = default;
 
       RunUserTask(const RunUserTask&) = default;
@@ -460,26 +1195,156 @@ namespace test {
       RunUserTask(RunUserTask&&) = default;
       RunUserTask& operator=(RunUserTask&&) = default;
 
-      // The operator co_await will track the parent's handle and then resume this child
+      // The operator co_await will track the parent's handle and then transfer to this child
       auto operator co_await() noexcept {
         struct Awaiter {
           Handle childHandle;
           bool await_ready() const noexcept { return false; }
 
-          // Save caller's handle, resume child, so child can eventually resume caller
-          void await_suspend(std::coroutine_handle<> caller) noexcept {
+          // Save caller's handle and tail-resume the child, so child can
+          // eventually transfer back to the caller from its final_suspend
+          std::coroutine_handle<> await_suspend(std::coroutine_handle<> caller) noexcept {
             childHandle.promise().parentHandle = caller;
-            childHandle.resume();
+            return childHandle;
           }
 
           void await_resume() noexcept {
-            // Parent continues after child is completely finished
+            // Parent continues after child is completely finished; the child
+            // is parked at its final suspend point, so free its frame now
+            childHandle.destroy();
           }
         };
         return Awaiter{handle};
       }
     };
 
+    // ============================================================
+    // TaskGroup  (fork/join of RunUserTasks inside a coroutine)
+    // ============================================================
+    // Shared by the tasks of one TaskGroup child; lives in the child's
+    // wrapper coroutine, so it outlives the group if need be
+    struct TaskSlot {
+      TaskGroup* group{}; // null once the group let go of the child
+      RunUserTask::Handle top{}; // the spawned task
+      std::coroutine_handle<> wrapper{};
+      bool cancel_requested{false};
+    };
+
+    // Runs RunUserTasks side by side for as long as a case needs them:
+    //   TaskGroup group;
+    //   group.spawn(monitor_line());
+    //   group.spawn(drive_frames());
+    //   co_await group.join();    // or group.cancel() to stop the rest
+    // spawn() starts the task at once; it runs until its first suspension.
+    // cancel() withdraws the awaitable each task is suspended on and frees
+    // its frames. A task that is running, or parked on something that
+    // cannot be withdrawn, stops at its next suspension point instead, so
+    // join() after cancel() waits for those. Destroying the group cancels
+    // what still runs.
+    class TaskGroup {
+    public:
+      TaskGroup() = default;
+      ~TaskGroup();
+
+      TaskGroup(const TaskGroup&) = delete;
+      TaskGroup& operator=(const TaskGroup&) = delete;
+
+      void spawn(RunUserTask task);
+      void cancel() noexcept;
+
+      [[nodiscard]] std::size_t running() const noexcept { return children_.size(); }
+
+      struct JoinAwaiter {
+        TaskGroup& group;
+
+        bool await_ready() const noexcept { return group.children_.empty(); }
+        void await_suspend(std::coroutine_handle<> h) noexcept { group.joiner_ = h; }
+        void await_resume() const noexcept {}
+
+        // Cancelling a joiner cancels what it joins; false while some of
+        // the group's tasks still have to reach a suspension point
+        bool cancel() noexcept {
+          const std::coroutine_handle<> joiner = std::exchange(group.joiner_, nullptr);
+          group.cancel();
+          if (group.children_.empty()) {
+            return true;
+          }
+          group.joiner_ = joiner;
+          return false;
+        }
+      };
+
+      // Resume once every spawned task has finished or been cancelled
+      JoinAwaiter join() noexcept { return JoinAwaiter{*this}; }
+
+      // Free the await chain of a cancelled child and its wrapper; returns
+      // the joiner if that was the last child, else null
+      static std::coroutine_handle<> unwind_(TaskSlot& slot) noexcept;
+
+    private:
+      struct Child {
+        struct promise_type {
+          using Handle = std::coroutine_handle<promise_type>;
+
+          TaskSlot slot;
+
+          promise_type(TaskGroup& group, const RunUserTask task) {
+            slot.group = &group;
+            slot.top = task.handle;
+            task.handle.promise().slot = &slot;
+          }
+
+          static void* operator new(std::size_t size) {
+            return frame_arena::allocate(size);
+          }
+
+          static void operator delete(void* ptr, std::size_t size) noexcept {
+            frame_arena::deallocate(ptr, size);
+          }
+
+          Child get_return_object() {
+            slot.wrapper = Handle::from_promise(*this);
+            return Child{Handle::from_promise(*this)};
+          }
+
+          std::suspend_always initial_suspend() noexcept { return {}; }
+
+          auto final_suspend() noexcept {
+            struct FinalAwaiter {
+              bool await_ready() const noexcept { return false; }
+
+              std::coroutine_handle<> await_suspend(Handle h) noexcept {
+                TaskGroup* group = h.promise().slot.group;
+                h.destroy();
+                const std::coroutine_handle<> next = group ? group->finished_(h) : nullptr;
+                return next ? next : std::noop_coroutine();
+              }
+
+              void await_resume() noexcept {
+              }
+            };
+            return FinalAwaiter{};
+          }
+
+          void return_void() {
+          }
+
+          void unhandled_exception() { std::terminate(); }
+        };
+
+        using Handle = std::coroutine_handle<promise_type>;
+        Handle handle;
+      };
+
+      static Child run_child_(TaskGroup& group, RunUserTask task);
+
+      // Drop a finished child; returns the joiner if it was the last one
+      std::coroutine_handle<> finished_(std::coroutine_handle<> wrapper) noexcept;
+
+      std::vector<Child::Handle> children_;
+      std::coroutine_handle<> joiner_{};
+    };
+
     // ============================================================
     // Factory helpers
     // ============================================================
@@ -492,10 +1357,41 @@ namespace test {
       return AwaitWrite{*this, delay_to_ticks_<U>(delay)};
     }
 
-    AwaitChange getCoChange(const std::string& net) {
+    template <typename Rep, typename Period>
+    AwaitWrite getCoWrite(const std::chrono::duration<Rep, Period> delay) {
+      return AwaitWrite{*this, toTicks(delay)};
+    }
+
+    // Hand every transition of 'steps' to the simulator at once as delayed
+    // puts on 'net', so a bit-banged sequence costs one call rather than one
+    // suspend per edge. vpiInertialDelay keeps only the last pending event of
+    // a net, so multi-edge waveforms want vpiTransportDelay.
+    AwaitWaveform scheduleWaveform(const Net& net, std::span<const WaveStep> steps,
+                                PLI_INT32 delay_mode = vpiTransportDelay);
+
+    AwaitWaveform scheduleWaveform(const Net& net, const std::initializer_list<WaveStep> steps,
+                                const PLI_INT32 delay_mode = vpiTransportDelay) {
+      return scheduleWaveform(net, std::span(steps.begin(), steps.size()), delay_mode);
+    }
+
+    AwaitWaveform scheduleWaveform(const std::string& net, const std::span<const WaveStep> steps,
+                                const PLI_INT32 delay_mode = vpiTransportDelay) {
+      return scheduleWaveform(getNet(net), steps, delay_mode);
+    }
+
+    AwaitWaveform scheduleWaveform(const std::string& net, const std::initializer_list<WaveStep> steps,
+                                const PLI_INT32 delay_mode = vpiTransportDelay) {
+      return scheduleWaveform(getNet(net), std::span(steps.begin(), steps.size()), delay_mode);
+    }
+
+    AwaitChange getCoChange(const Net& net) {
       return AwaitChange{*this, net};
     }
 
+    AwaitChange getCoChange(const std::string& net) {
+      return AwaitChange{*this, getNet(net)};
+    }
+
     AwaitRead getCoRead() {
       return AwaitRead{*this, 0};
     }
@@ -505,10 +1401,126 @@ namespace test {
       return AwaitRead{*this, delay_to_ticks_<U>(delay)};
     }
 
-    AwaitChange getCoChange(const std::string& net, unsigned long long int target_value) {
+    template <typename Rep, typename Period>
+    AwaitRead getCoRead(const std::chrono::duration<Rep, Period> delay) {
+      return AwaitRead{*this, toTicks(delay)};
+    }
+
+    AwaitChange getCoChange(const Net& net, unsigned long long int target_value) {
       return AwaitChange{*this, net, target_value};
     }
 
+    AwaitChange getCoChange(const std::string& net, unsigned long long int target_value) {
+      return AwaitChange{*this, getNet(net), target_value};
+    }
+
+    // Resumes once the net equals 'target_bits' in all four states (x and z
+    // must match exactly); the target is sized to the net width
+    AwaitChange getCoChange(const Net& net, const BitVector& target_bits) {
+      return AwaitChange{*this, net, target_bits.slice(0, net.length())};
+    }
+
+    AwaitChange getCoChange(const std::string& net, const BitVector& target_bits) {
+      return getCoChange(getNet(net), target_bits);
+    }
+
+    // Resumes once (net & mask) == (value & mask). The condition is checked in
+    // the value-change callback, so non-matching changes never resume the
+    // coroutine; if it already holds, co_await does not suspend at all
+    AwaitChange getCoChange(const Net& net, unsigned long long int mask, unsigned long long int value) {
+      return AwaitChange{*this, net, mask, value};
+    }
+
+    AwaitChange getCoChange(const std::string& net, unsigned long long int mask,
+                            unsigned long long int value) {
+      return AwaitChange{*this, getNet(net), mask, value};
+    }
+
+    // Resumes once 'predicate' accepts the net value, read as getNum() reads it.
+    // Evaluated like the masked form, and on await before suspending
+    AwaitChange getCoChange(const Net& net, ChangePredicate predicate) {
+      return AwaitChange{*this, net, std::move(predicate)};
+    }
+
+    AwaitChange getCoChange(const std::string& net, ChangePredicate predicate) {
+      return AwaitChange{*this, getNet(net), std::move(predicate)};
+    }
+
+    template <unsigned int Width>
+    AwaitChange getCoChange(const TypedNet<Width>& net) {
+      return AwaitChange{*this, net.net()};
+    }
+
+    template <unsigned int Width>
+    AwaitChange getCoChange(const TypedNet<Width>& net,
+                            const std::type_identity_t<NetValue<Width>> target_value) {
+      return AwaitChange{*this, net.net(), static_cast<unsigned long long int>(target_value.get())};
+    }
+
+    template <unsigned int Width>
+    AwaitChange getCoChange(const TypedNet<Width>& net, const BitVector& target_bits) {
+      return getCoChange(net.net(), target_bits);
+    }
+
+    template <unsigned int Width>
+    AwaitChange getCoChange(const TypedNet<Width>& net, unsigned long long int mask,
+                            unsigned long long int value) {
+      return AwaitChange{*this, net.net(), mask, value};
+    }
+
+    template <unsigned int Width>
+    AwaitChange getCoChange(const TypedNet<Width>& net, ChangePredicate predicate) {
+      return AwaitChange{*this, net.net(), std::move(predicate)};
+    }
+
+    // Resumes once 'predicate' accepts the values of all 'nets'
+    AwaitWatch getCoWatch(std::vector<Net> nets, WatchPredicate predicate) {
+      return AwaitWatch{*this, std::move(nets), std::move(predicate)};
+    }
+
+    AwaitWatch getCoWatch(const std::initializer_list<std::string> nets, WatchPredicate predicate) {
+      std::vector<Net> handles;
+      handles.reserve(nets.size());
+      for (const std::string& net : nets) {
+        handles.push_back(getNet(net));
+      }
+      return AwaitWatch{*this, std::move(handles), std::move(predicate)};
+    }
+
+    // Resume when the first of 'awaitables' completes; co_await yields its
+    // index, or nullopt if the group itself was cancelled (e.g. by a
+    // TaskGroup) first. The others are cancelled, so their callbacks never fire:
+    //   auto chg = test.getCoChange("irq", 1);
+    //   auto tmo = test.getCoWrite<test::ns>(500);
+    //   if (co_await test.whenAny(chg, tmo) == 1) { /* timed out */ }
+    template <CancellableAwaitable... Awaitables>
+    AwaitGroup<Awaitables...> whenAny(Awaitables&... awaitables) {
+      return AwaitGroup<Awaitables...>{1, awaitables...};
+    }
+
+    // Resume once every one of 'awaitables' has completed
+    template <CancellableAwaitable... Awaitables>
+    AwaitGroup<Awaitables...> whenAll(Awaitables&... awaitables) {
+      return AwaitGroup<Awaitables...>{sizeof...(Awaitables), awaitables...};
+    }
+
+    // Await 'awaitable' for at most 'delay'. A single timer is armed for the
+    // deadline; whichever side loses has its callback removed, so a long
+    // timeout costs two registrations however many cycles it spans:
+    //   auto rdy = test.getCoChange("ready", 1u, 1u);
+    //   if (co_await test.withTimeout<test::us>(rdy, 10) == TimeoutResult::timed_out) { ... }
+    template <TimeUnit U, typename A>
+      requires CancellableAwaitable<std::remove_reference_t<A>>
+    AwaitTimeout<A, AwaitWrite> withTimeout(A&& awaitable, const delay_arg_t<U> delay) {
+      return AwaitTimeout<A, AwaitWrite>{std::forward<A>(awaitable), getCoWrite<U>(delay)};
+    }
+
+    template <typename A, typename Rep, typename Period>
+      requires CancellableAwaitable<std::remove_reference_t<A>>
+    AwaitTimeout<A, AwaitWrite> withTimeout(A&& awaitable, const std::chrono::duration<Rep, Period> delay) {
+      return AwaitTimeout<A, AwaitWrite>{std::forward<A>(awaitable), getCoWrite(delay)};
+    }
+
     // ============================================================
     // Test registration
     // ============================================================
@@ -520,28 +1532,34 @@ namespace test {
     std::vector<std::coroutine_handle<>> test_handles;
 
   private:
-    [[nodiscard]] long double require_vpi_tick_period_s_() const {
-      if (vpi_tick_period_s_ <= 0.0L) {
+    [[nodiscard]] const detail::TickRatio& require_tick_ratio_(const TimeUnit unit) const {
+      const detail::TickRatio& ratio = tick_ratios_[static_cast<std::size_t>(unit)];
+      if (ratio.scale <= 0.0L) {
         throw std::runtime_error("RapidVPI VPI time precision has not been initialized");
       }
-      return vpi_tick_period_s_;
+      return ratio;
     }
 
+    // Whole delays stay in integers; fractional ones scale once and round up
     template <TimeUnit U>
     [[nodiscard]] sim_tick_t delay_to_ticks_(const delay_arg_t<U> delay) const {
       if constexpr (U == TimeUnit::ticks) {
         return delay;
       }
       else {
+        const detail::TickRatio& ratio = require_tick_ratio_(U);
         if (delay <= 0.0) {
           return 0;
         }
 
-        const long double raw_ticks =
-          static_cast<long double>(delay) * TimeUnitSeconds<U>::value /
-          require_vpi_tick_period_s_();
+        if (ratio.mul != 0 && delay < 0x1p63) {
+          const auto whole = static_cast<sim_tick_t>(delay);
+          if (static_cast<delay_arg_t<U>>(whole) == delay) {
+            return scale_whole_ticks_(whole, ratio.mul, ratio.div);
+          }
+        }
 
-        return ceil_delay_ticks_(raw_ticks);
+        return ceil_delay_ticks_(static_cast<long double>(delay) * ratio.scale);
       }
     }
 
@@ -551,11 +1569,32 @@ namespace test {
         return tick_count;
       }
       else {
-        const long double seconds =
-          static_cast<long double>(tick_count) * require_vpi_tick_period_s_();
-        const long double value = seconds / TimeUnitSeconds<U>::value;
-        return static_cast<double>(value);
+        const detail::TickRatio& ratio = require_tick_ratio_(U);
+        if (ratio.mul > 1) {
+          return static_cast<double>(tick_count / ratio.mul) +
+            static_cast<double>(tick_count % ratio.mul) / static_cast<double>(ratio.mul);
+        }
+        if (ratio.mul == 1) {
+          return static_cast<double>(static_cast<long double>(tick_count) *
+            static_cast<long double>(ratio.div));
+        }
+        return static_cast<double>(static_cast<long double>(tick_count) / ratio.scale);
+      }
+    }
+
+    // count * mul / div, rounded up
+    [[nodiscard]] static sim_tick_t scale_whole_ticks_(const sim_tick_t count,
+                                                       const std::uint64_t mul,
+                                                       const std::uint64_t div) {
+      if (div > 1) {
+        return count / div + (count % div != 0 ? 1 : 0);
       }
+
+      sim_tick_t ticks;
+      if (__builtin_mul_overflow(count, mul, &ticks)) {
+        throw std::overflow_error("RapidVPI delay exceeds sim_tick_t range");
+      }
+      return ticks;
     }
 
     [[nodiscard]] static sim_tick_t ceil_delay_ticks_(const long double raw_ticks) {
@@ -588,12 +1627,53 @@ namespace test {
       return static_cast<sim_tick_t>(rounded_ticks);
     }
 
+    vpiHandle dutScope_(); // resolve the DUT scope once, walking it in discover mode
+
     std::string dutName; // name of the DUT
     int vpi_time_precision_exp10_; // vpi_get(vpiTimePrecision, nullptr) result
     long double vpi_tick_period_s_; // physical duration of one raw VPI tick
+    std::array<detail::TickRatio, 5> tick_ratios_{}; // ticks per TimeUnit, set with the precision
     std::unordered_map<std::string, t_netmap_value> netMap; // [key, value] list of DUT signals
+    NetResolution net_resolution_{NetResolution::eager};
+    vpiHandle dut_scope_{nullptr}; // cached DUT scope for lazy/discover
+    std::size_t nets_declared_{0}; // addNet calls
+    std::size_t nets_discovered_{0}; // nets found by the scope walk
+#ifdef RAPIDVPI_STATS
+    unsigned long long net_lookups_{0}; // name-keyed netMap finds
+#endif
   };
 
+  template <typename Rep, typename Period>
+  inline sim_tick_t TestBase::toTicks(const std::chrono::duration<Rep, Period> delay) const {
+    static_cast<void>(require_tick_ratio_(TimeUnit::ns)); // throws before the precision is set
+    if (delay.count() <= 0) {
+      return 0;
+    }
+
+    // ticks = count * num / (den * 10^precision)
+    const int precision_exp10 = vpi_time_precision_exp10_;
+    if constexpr (std::is_integral_v<Rep>) {
+      const detail::TickRatio tick_ratio = detail::make_tick_ratio(0, precision_exp10);
+      if (tick_ratio.mul != 0) {
+        unsigned __int128 num = static_cast<unsigned __int128>(delay.count());
+        unsigned __int128 den = static_cast<unsigned __int128>(Period::den) * tick_ratio.div;
+        if (__builtin_mul_overflow(num, static_cast<unsigned __int128>(Period::num) * tick_ratio.mul, &num)) {
+          throw std::overflow_error("RapidVPI delay exceeds sim_tick_t range");
+        }
+
+        const unsigned __int128 ticks = num / den + (num % den != 0 ? 1 : 0);
+        if (ticks > std::numeric_limits<sim_tick_t>::max()) {
+          throw std::overflow_error("RapidVPI delay exceeds sim_tick_t range");
+        }
+        return static_cast<sim_tick_t>(ticks);
+      }
+    }
+
+    const long double seconds = static_cast<long double>(delay.count()) *
+      static_cast<long double>(Period::num) / static_cast<long double>(Period::den);
+    return ceil_delay_ticks_(seconds * detail::pow10_ld(-precision_exp10));
+  }
+
   template <TimeUnit U>
   inline void TestBase::AwaitWrite::setDelay(const delay_arg_t<U> delay) {
     delay_ticks = parent.delay_to_ticks_<U>(delay);
@@ -604,6 +1684,25 @@ namespace test {
     delay_ticks = parent.delay_to_ticks_<U>(delay);
   }
 
+  template <unsigned int Width>
+  inline net_value_t<Width> TestBase::AwaitRead::getNum(const TypedNet<Width>& net) {
+    static_assert(Width <= 64, "getNum() is limited to nets of 64 bits or less");
+
+    // The two least significant chunks are the last ones await_resume pushed
+    const t_read_value* result = findRead(net.net());
+    if (result == nullptr || result->uintValues.size() < std::min(TypedNet<Width>::vecval_len, 2u)) {
+      std::printf("[WARNING]\tNo value for net: %s\n", net.name());
+      return net_value_t<Width>{};
+    }
+
+    const std::vector<unsigned int>& chunks = result->uintValues;
+    std::uint64_t value = chunks.back();
+    if constexpr (TypedNet<Width>::vecval_len >= 2) {
+      value |= static_cast<std::uint64_t>(chunks[chunks.size() - 2]) << 32;
+    }
+    return static_cast<net_value_t<Width>>(value & TypedNet<Width>::mask);
+  }
+
   template <TimeUnit U>
   inline time_value_t<U> TestBase::AwaitRead::getTime() const {
     return parent.ticks_to_time_<U>(resume_time_ticks);
@@ -613,6 +1712,11 @@ namespace test {
   inline time_value_t<U> TestBase::AwaitChange::getTime() const {
     return parent.ticks_to_time_<U>(resume_time_ticks);
   }
+
+  template <TimeUnit U>
+  inline time_value_t<U> TestBase::AwaitWatch::getTime() const {
+    return parent.ticks_to_time_<U>(resume_time_ticks);
+  }
 } // namespace test
 
 #endif // DUT_TOP_TESTBASE_HPP
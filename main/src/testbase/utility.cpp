@@ -28,7 +28,6 @@
 #include <stdexcept>
 #include <string>
 #include <string_view>
-#include <utility>
 
 namespace {
     using BinLut = std::array<const char *, 256>;
@@ -166,42 +165,6 @@ namespace {
 
         return hex.substr(first_non_zero);
     }
-
-    // Ready for a future awaitwrite.cpp fast path where hex can be packed straight
-    // into s_vpi_vecval without first materializing a binary string.
-    [[maybe_unused]] [[nodiscard]] std::pair<std::uint8_t, std::uint8_t>
-    hex_char_to_aval_bval_nibble(const unsigned char c) {
-        switch (c) {
-            case '0': return {0x0u, 0x0u};
-            case '1': return {0x1u, 0x0u};
-            case '2': return {0x2u, 0x0u};
-            case '3': return {0x3u, 0x0u};
-            case '4': return {0x4u, 0x0u};
-            case '5': return {0x5u, 0x0u};
-            case '6': return {0x6u, 0x0u};
-            case '7': return {0x7u, 0x0u};
-            case '8': return {0x8u, 0x0u};
-            case '9': return {0x9u, 0x0u};
-            case 'A':
-            case 'a': return {0xAu, 0x0u};
-            case 'B':
-            case 'b': return {0xBu, 0x0u};
-            case 'C':
-            case 'c': return {0xCu, 0x0u};
-            case 'D':
-            case 'd': return {0xDu, 0x0u};
-            case 'E':
-            case 'e': return {0xEu, 0x0u};
-            case 'F':
-            case 'f': return {0xFu, 0x0u};
-            case 'X':
-            case 'x': return {0xFu, 0xFu};
-            case 'Z':
-            case 'z': return {0x0u, 0xFu};
-            default:
-                throw std::invalid_argument("Invalid hex character");
-        }
-    }
 } // namespace
 
 namespace test {
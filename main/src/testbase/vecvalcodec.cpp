@@ -0,0 +1,346 @@
+// MIT License
+//
+// Copyright (c) 2024 Rovshan Rustamov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "vecvalcodec.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(RAPIDVPI_NO_SIMD)
+#define RAPIDVPI_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace test::detail {
+  namespace {
+    // Per-character codes: bit 0 = aval, bit 1 = bval, 'invalid' = not a digit
+    constexpr std::uint8_t invalid = 0x80;
+
+    constexpr std::array<std::uint8_t, 256> bin_codes = [] {
+      std::array<std::uint8_t, 256> t{};
+      t.fill(invalid);
+      t['0'] = 0x0;
+      t['1'] = 0x1;
+      t['z'] = t['Z'] = 0x2;
+      t['x'] = t['X'] = 0x3;
+      return t;
+    }();
+
+    // Hex digits: low nibble = aval, high nibble = bval
+    constexpr std::array<std::uint16_t, 256> hex_codes = [] {
+      std::array<std::uint16_t, 256> t{};
+      t.fill(invalid << 8);
+      for (unsigned int d = 0; d < 10; ++d) {
+        t['0' + d] = static_cast<std::uint16_t>(d);
+      }
+      for (unsigned int d = 0; d < 6; ++d) {
+        t['a' + d] = t['A' + d] = static_cast<std::uint16_t>(10 + d);
+      }
+      t['z'] = t['Z'] = 0xF0;
+      t['x'] = t['X'] = 0xFF;
+      return t;
+    }();
+
+    constexpr std::array<char, 16> hex_digits = {
+      '0', '1', '2', '3', '4', '5', '6', '7',
+      '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'
+    };
+
+    // Scalar packing of up to 32 binary / 8 hex characters (MSB first) into one chunk
+    bool bin_chunk(const char* first, const char* last, s_vpi_vecval& out) {
+      std::uint32_t aval = 0;
+      std::uint32_t bval = 0;
+      std::uint8_t bad = 0;
+      for (; first != last; ++first) {
+        const std::uint8_t code = bin_codes[static_cast<unsigned char>(*first)];
+        aval = (aval << 1) | (code & 1u);
+        bval = (bval << 1) | ((code >> 1) & 1u);
+        bad |= code;
+      }
+      out.aval = static_cast<PLI_INT32>(aval);
+      out.bval = static_cast<PLI_INT32>(bval);
+      return (bad & invalid) == 0;
+    }
+
+    bool hex_chunk(const char* first, const char* last, s_vpi_vecval& out) {
+      std::uint32_t aval = 0;
+      std::uint32_t bval = 0;
+      std::uint16_t bad = 0;
+      for (; first != last; ++first) {
+        const std::uint16_t code = hex_codes[static_cast<unsigned char>(*first)];
+        aval = (aval << 4) | (code & 0xFu);
+        bval = (bval << 4) | ((code >> 4) & 0xFu);
+        bad |= code;
+      }
+      out.aval = static_cast<PLI_INT32>(aval);
+      out.bval = static_cast<PLI_INT32>(bval);
+      return (bad & (invalid << 8)) == 0;
+    }
+
+#ifndef RAPIDVPI_X86_SIMD
+    void bin_chars(const std::uint32_t aval, const std::uint32_t bval, char* out) {
+      for (int j = 31; j >= 0; --j) {
+        const unsigned int a = (aval >> j) & 1u;
+        if ((bval >> j) & 1u) {
+          *out++ = a ? 'x' : 'z';
+        }
+        else {
+          *out++ = static_cast<char>('0' + a);
+        }
+      }
+    }
+#endif
+
+#ifdef RAPIDVPI_X86_SIMD
+    // ---- SSE2 (baseline on x86-64) ----
+
+    // Reverse the 16 bytes so movemask bit i lines up with string bit i
+    inline __m128i reverse_bytes(__m128i v) {
+      v = _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 1, 2, 3));
+      v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+      v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+      return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+    }
+
+    // 16 binary characters -> 16 aval/bval bits
+    inline bool bin16_sse2(const char* p, std::uint32_t& aval, std::uint32_t& bval) {
+      const __m128i v = reverse_bytes(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+      const __m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+      const __m128i zero = _mm_cmpeq_epi8(v, _mm_set1_epi8('0'));
+      const __m128i one = _mm_cmpeq_epi8(v, _mm_set1_epi8('1'));
+      const __m128i x = _mm_cmpeq_epi8(lower, _mm_set1_epi8('x'));
+      const __m128i z = _mm_cmpeq_epi8(lower, _mm_set1_epi8('z'));
+      const __m128i b = _mm_or_si128(x, z);
+
+      aval = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_or_si128(one, x)));
+      bval = static_cast<std::uint32_t>(_mm_movemask_epi8(b));
+      return _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(zero, one), b)) == 0xFFFF;
+    }
+
+    bool bin_chunk_sse2(const char* p, s_vpi_vecval& out) {
+      std::uint32_t a_hi, b_hi, a_lo, b_lo;
+      const bool ok_hi = bin16_sse2(p, a_hi, b_hi);
+      const bool ok_lo = bin16_sse2(p + 16, a_lo, b_lo);
+      out.aval = static_cast<PLI_INT32>((a_hi << 16) | a_lo);
+      out.bval = static_cast<PLI_INT32>((b_hi << 16) | b_lo);
+      return ok_hi && ok_lo;
+    }
+
+    // 16 value bits -> 16 byte masks, MSB first
+    inline __m128i expand16_sse2(const std::uint32_t bits) {
+      __m128i v = _mm_cvtsi32_si128(static_cast<int>(((bits >> 8) & 0xFFu) | ((bits & 0xFFu) << 8)));
+      v = _mm_unpacklo_epi8(v, v);
+      v = _mm_unpacklo_epi16(v, v);
+      v = _mm_unpacklo_epi32(v, v);
+      const __m128i select = _mm_setr_epi8(-128, 64, 32, 16, 8, 4, 2, 1,
+                                           -128, 64, 32, 16, 8, 4, 2, 1);
+      return _mm_cmpeq_epi8(_mm_and_si128(v, select), select);
+    }
+
+    inline void bin16_chars_sse2(const std::uint32_t aval, const std::uint32_t bval, char* out) {
+      const __m128i a = expand16_sse2(aval);
+      const __m128i b = expand16_sse2(bval);
+      // '0'/'1' where bval is clear, 'z'/'x' where it is set
+      const __m128i digit = _mm_add_epi8(_mm_set1_epi8('0'), _mm_and_si128(a, _mm_set1_epi8(1)));
+      const __m128i xz = _mm_sub_epi8(_mm_set1_epi8('z'), _mm_and_si128(a, _mm_set1_epi8(2)));
+      const __m128i chars = _mm_or_si128(_mm_and_si128(b, xz), _mm_andnot_si128(b, digit));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out), chars);
+    }
+
+    void bin_chars_sse2(const std::uint32_t aval, const std::uint32_t bval, char* out) {
+      bin16_chars_sse2(aval >> 16, bval >> 16, out);
+      bin16_chars_sse2(aval & 0xFFFFu, bval & 0xFFFFu, out + 16);
+    }
+
+    // 16 hex characters -> two chunks (high, low)
+    bool hex16_sse2(const char* p, s_vpi_vecval& high, s_vpi_vecval& low) {
+      const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+      const __m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+      // Signed compares: bytes >= 0x80 are negative and fail every range
+      const __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('0' - 1)),
+                                          _mm_cmplt_epi8(v, _mm_set1_epi8('9' + 1)));
+      const __m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+                                          _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+      const __m128i x = _mm_cmpeq_epi8(lower, _mm_set1_epi8('x'));
+      const __m128i z = _mm_cmpeq_epi8(lower, _mm_set1_epi8('z'));
+      const __m128i nibble = _mm_set1_epi8(0x0F);
+
+      const __m128i a = _mm_or_si128(
+        _mm_or_si128(_mm_and_si128(digit, _mm_sub_epi8(v, _mm_set1_epi8('0'))),
+                     _mm_and_si128(alpha, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10)))),
+        _mm_and_si128(x, nibble));
+      const __m128i b = _mm_and_si128(_mm_or_si128(x, z), nibble);
+      const bool ok = _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(digit, alpha), _mm_or_si128(x, z))) == 0xFFFF;
+
+      // Pair up nibbles into bytes (first character high), then the 8 bytes
+      // read as a big-endian 64-bit value
+      const auto pack = [](const __m128i n) {
+        const __m128i pairs = _mm_and_si128(_mm_or_si128(_mm_slli_epi16(n, 4), _mm_srli_epi16(n, 8)),
+                                            _mm_set1_epi16(0x00FF));
+        std::uint64_t bytes;
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(&bytes), _mm_packus_epi16(pairs, pairs));
+        return __builtin_bswap64(bytes);
+      };
+      const std::uint64_t aval = pack(a);
+      const std::uint64_t bval = pack(b);
+
+      high.aval = static_cast<PLI_INT32>(aval >> 32);
+      high.bval = static_cast<PLI_INT32>(bval >> 32);
+      low.aval = static_cast<PLI_INT32>(aval & 0xFFFFFFFFu);
+      low.bval = static_cast<PLI_INT32>(bval & 0xFFFFFFFFu);
+      return ok;
+    }
+
+    // ---- AVX2 (selected at run time) ----
+
+    __attribute__((target("avx2"))) bool bin_chunk_avx2(const char* p, s_vpi_vecval& out) {
+      __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+      const __m256i reverse = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+                                               15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+      v = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(v, reverse), _MM_SHUFFLE(1, 0, 3, 2));
+
+      const __m256i lower = _mm256_or_si256(v, _mm256_set1_epi8(0x20));
+      const __m256i zero = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('0'));
+      const __m256i one = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('1'));
+      const __m256i x = _mm256_cmpeq_epi8(lower, _mm256_set1_epi8('x'));
+      const __m256i z = _mm256_cmpeq_epi8(lower, _mm256_set1_epi8('z'));
+      const __m256i b = _mm256_or_si256(x, z);
+
+      out.aval = _mm256_movemask_epi8(_mm256_or_si256(one, x));
+      out.bval = _mm256_movemask_epi8(b);
+      return _mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(zero, one), b)) == -1;
+    }
+
+    __attribute__((target("avx2"))) inline __m256i expand32_avx2(const std::uint32_t bits) {
+      const __m256i spread = _mm256_setr_epi8(3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2,
+                                              1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0);
+      const __m256i select = _mm256_setr_epi8(-128, 64, 32, 16, 8, 4, 2, 1, -128, 64, 32, 16, 8, 4, 2, 1,
+                                              -128, 64, 32, 16, 8, 4, 2, 1, -128, 64, 32, 16, 8, 4, 2, 1);
+      const __m256i v = _mm256_shuffle_epi8(_mm256_set1_epi32(static_cast<int>(bits)), spread);
+      return _mm256_cmpeq_epi8(_mm256_and_si256(v, select), select);
+    }
+
+    __attribute__((target("avx2"))) void bin_chars_avx2(const std::uint32_t aval,
+                                                        const std::uint32_t bval,
+                                                        char* out) {
+      const __m256i a = expand32_avx2(aval);
+      const __m256i b = expand32_avx2(bval);
+      const __m256i digit = _mm256_add_epi8(_mm256_set1_epi8('0'), _mm256_and_si256(a, _mm256_set1_epi8(1)));
+      const __m256i xz = _mm256_sub_epi8(_mm256_set1_epi8('z'), _mm256_and_si256(a, _mm256_set1_epi8(2)));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), _mm256_blendv_epi8(digit, xz, b));
+    }
+
+    const bool has_avx2 = [] {
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx2") != 0;
+    }();
+#endif
+  } // namespace
+
+  bool hex_to_vecval(const std::string_view hex, s_vpi_vecval* out, const unsigned int vecval_len) {
+    const char* const begin = hex.data();
+    const char* end = begin + hex.size();
+    bool ok = true;
+    unsigned int i = 0;
+
+#ifdef RAPIDVPI_X86_SIMD
+    // Two full chunks (16 digits) per step from the LSB end
+    for (; i + 1 < vecval_len && end - begin >= 16; i += 2, end -= 16) {
+      ok &= hex16_sse2(end - 16, out[i + 1], out[i]);
+    }
+#endif
+
+    for (; i < vecval_len; ++i) {
+      const char* first = end - begin >= 8 ? end - 8 : begin;
+      ok &= hex_chunk(first, end, out[i]);
+      end = first;
+    }
+    return ok;
+  }
+
+  bool bin_to_vecval(const std::string_view bin, s_vpi_vecval* out, const unsigned int vecval_len) {
+    const char* const begin = bin.data();
+    const char* end = begin + bin.size();
+    bool ok = true;
+
+    for (unsigned int i = 0; i < vecval_len; ++i) {
+      if (end - begin < 32) {
+        ok &= bin_chunk(begin, end, out[i]);
+        end = begin;
+        continue;
+      }
+#ifdef RAPIDVPI_X86_SIMD
+      ok &= has_avx2 ? bin_chunk_avx2(end - 32, out[i]) : bin_chunk_sse2(end - 32, out[i]);
+#else
+      ok &= bin_chunk(end - 32, end, out[i]);
+#endif
+      end -= 32;
+    }
+    return ok;
+  }
+
+  void vecval_to_bin(const s_vpi_vecval* in, const unsigned int vecval_len, char* out) {
+    for (unsigned int i = vecval_len; i-- > 0; out += 32) {
+      const auto aval = static_cast<std::uint32_t>(in[i].aval);
+      const auto bval = static_cast<std::uint32_t>(in[i].bval);
+#ifdef RAPIDVPI_X86_SIMD
+      if (has_avx2) {
+        bin_chars_avx2(aval, bval, out);
+      }
+      else {
+        bin_chars_sse2(aval, bval, out);
+      }
+#else
+      bin_chars(aval, bval, out);
+#endif
+    }
+  }
+
+  std::string vecval_to_hex(const s_vpi_vecval* in, const unsigned int vecval_len) {
+    std::string hex(static_cast<std::size_t>(vecval_len) * 8, '0');
+    char* out = hex.data();
+
+    for (unsigned int i = vecval_len; i-- > 0; out += 8) {
+      const auto aval = static_cast<std::uint32_t>(in[i].aval);
+      const auto bval = static_cast<std::uint32_t>(in[i].bval);
+      for (int j = 7; j >= 0; --j) {
+        const unsigned int a = (aval >> (4 * j)) & 0xFu;
+        const unsigned int b = (bval >> (4 * j)) & 0xFu;
+        if (b == 0) {
+          out[7 - j] = hex_digits[a];
+        }
+        else {
+          out[7 - j] = (b == 0xF && a == 0) ? 'Z' : 'X';
+        }
+      }
+    }
+
+    const std::size_t first_non_zero = hex.find_first_not_of('0');
+    if (first_non_zero == std::string::npos) {
+      return "0";
+    }
+    hex.erase(0, first_non_zero);
+    return hex;
+  }
+} // namespace test::detail
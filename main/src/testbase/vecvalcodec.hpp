@@ -0,0 +1,58 @@
+// MIT License
+//
+// Copyright (c) 2024 Rovshan Rustamov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+// Description: Direct conversion between hex/binary value strings and VPI
+// vecval words. Writes pack a string straight into s_vpi_vecval without an
+// intermediate binary string, and reads unpack vecval words straight into
+// characters. Full 32-bit chunks go through SSE2/AVX2 kernels on x86-64
+// (AVX2 is picked at run time); define RAPIDVPI_NO_SIMD to force the scalar
+// paths.
+
+#ifndef DUT_TOP_VECVALCODEC_HPP
+#define DUT_TOP_VECVALCODEC_HPP
+
+#include <string>
+#include <string_view>
+
+#include <vpi_user.h>
+
+namespace test::detail {
+  // Pack a hex string (0-9, a-f, x, z in either case, MSB first) into
+  // 'vecval_len' chunks. Every chunk is written: missing high digits are zero
+  // and digits beyond the chunks are dropped. Invalid characters leave their
+  // bits at 0; returns false if any were seen.
+  bool hex_to_vecval(std::string_view hex, s_vpi_vecval* out, unsigned int vecval_len);
+
+  // Same for a binary string (0, 1, x, z in either case, MSB first)
+  bool bin_to_vecval(std::string_view bin, s_vpi_vecval* out, unsigned int vecval_len);
+
+  // Write 'vecval_len' * 32 characters (0/1/x/z, MSB first) to 'out'
+  void vecval_to_bin(const s_vpi_vecval* in, unsigned int vecval_len, char* out);
+
+  // Hex string with leading zeros trimmed, matching TestBase::bin_to_hex of
+  // the binary string: all-x and all-z nibbles print as X and Z, mixed ones
+  // collapse to X.
+  std::string vecval_to_hex(const s_vpi_vecval* in, unsigned int vecval_len);
+} // namespace test::detail
+
+#endif // DUT_TOP_VECVALCODEC_HPP
@@ -32,7 +32,8 @@ Clock::Clock(TestBase& tb, std::string net_name, std::string task_name)
     , utils_(tb)
     , log_()
     , net_name_(std::move(net_name))
-    , task_name_(std::move(task_name)) {
+    , task_name_(std::move(task_name))
+    , edges_(net_name_) {
     tb_.registerTest(task_name_, [this]() { return this->clk_run().handle; });
 }
 
@@ -56,9 +57,11 @@ Clock::RunUserTask Clock::apply_requests_() {
 
         // When stopping, park clock low deterministically.
         if (!running_applied_) {
+            edges_.set_period(0u);
             auto w = tb_.getCoWrite();
             w.write(net_name_, 0);
             co_await w;
+            edges_.drive(0);
         }
     }
 
@@ -71,6 +74,7 @@ Clock::RunTask Clock::clk_run() {
         auto w = tb_.getCoWrite();
         w.write(net_name_, 0);
         co_await w;
+        edges_.drive(0);
     }
 
     for (;;) {
@@ -96,6 +100,8 @@ Clock::RunTask Clock::clk_run() {
             auto w = tb_.getCoWrite();
             w.write(net_name_, 1);
             co_await w;
+            edges_.set_period(period_applied_ticks_);
+            edges_.drive(1);
         }
         co_await utils_.delay<test::ticks>(high_ticks);
 
@@ -109,6 +115,7 @@ Clock::RunTask Clock::clk_run() {
             auto w = tb_.getCoWrite();
             w.write(net_name_, 0);
             co_await w;
+            edges_.drive(0);
         }
         co_await utils_.delay<test::ticks>(low_ticks);
     }
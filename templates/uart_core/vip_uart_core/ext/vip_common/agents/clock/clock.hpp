@@ -71,6 +71,9 @@ public:
     const std::string& net_name() const { return net_name_; }
     const std::string& task_name() const { return task_name_; }
 
+    // Edge counters for the driven net (used by CommonUtils::clock)
+    const ClockEdges& edges() const { return edges_; }
+
 private:
     TestBase& tb_;
     CommonUtils utils_;
@@ -79,6 +82,9 @@ private:
     std::string net_name_;
     std::string task_name_;
 
+    // Published edge counters; advanced after every write of the clock net
+    ClockEdges edges_;
+
     // Requested state (written by cases)
     bool running_req_ = false;
     test::sim_tick_t period_req_ticks_ = 10u;
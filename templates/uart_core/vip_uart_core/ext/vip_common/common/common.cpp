@@ -24,25 +24,121 @@
 
 #include "vip_common/common/common.hpp"
 
+#include <algorithm>
+#include <unordered_map>
+
 namespace vip::common {
 
+namespace {
+
+std::unordered_map<std::string, ClockEdges*>& clock_edges_registry() {
+    static std::unordered_map<std::string, ClockEdges*> registry;
+    return registry;
+}
+
+} // namespace
+
+ClockEdges::ClockEdges(std::string net)
+    : net_(std::move(net)) {
+    clock_edges_registry()[net_] = this;
+}
+
+ClockEdges::~ClockEdges() {
+    auto& registry = clock_edges_registry();
+    if (auto it = registry.find(net_); it != registry.end() && it->second == this) {
+        registry.erase(it);
+    }
+}
+
+ClockEdges* ClockEdges::find(const std::string& net) {
+    const auto& registry = clock_edges_registry();
+    const auto it = registry.find(net);
+    return it == registry.end() ? nullptr : it->second;
+}
+
+namespace {
+
+struct LaterWaiter {
+    template <typename W>
+    bool operator()(const W& a, const W& b) const {
+        return a.target != b.target ? a.target > b.target : a.seq > b.seq;
+    }
+};
+
+} // namespace
+
+void ClockEdges::park_(const int edge, const std::uint64_t target, std::coroutine_handle<> h) {
+    auto& heap = edge ? rise_waiters_ : fall_waiters_;
+    heap.push_back(Waiter{target, seq_++, h});
+    std::push_heap(heap.begin(), heap.end(), LaterWaiter{});
+    ++parked_waits_;
+}
+
+bool ClockEdges::unpark_(const int edge, const std::coroutine_handle<> h) noexcept {
+    auto& heap = edge ? rise_waiters_ : fall_waiters_;
+    const auto it = std::find_if(heap.begin(), heap.end(),
+                                 [h](const Waiter& w) { return w.handle == h; });
+    if (it == heap.end()) {
+        return false;
+    }
+
+    heap.erase(it);
+    std::make_heap(heap.begin(), heap.end(), LaterWaiter{});
+    return true;
+}
+
+void ClockEdges::wake_(std::vector<Waiter>& heap, const std::uint64_t now) {
+    // Pop before resuming: a resumed waiter may park again on this heap.
+    while (!heap.empty() && heap.front().target <= now) {
+        std::pop_heap(heap.begin(), heap.end(), LaterWaiter{});
+        const std::coroutine_handle<> h = heap.back().handle;
+        heap.pop_back();
+        h.resume();
+    }
+}
+
+void ClockEdges::drive(const int level) {
+    const int new_level = level ? 1 : 0;
+    if (new_level == level_) {
+        return;
+    }
+    level_ = new_level;
+
+    if (new_level) {
+        last_rise_tick_ = sim_time_ticks();
+        ++rises_;
+        wake_(rise_waiters_, rises_);
+    } else {
+        ++falls_;
+        wake_(fall_waiters_, falls_);
+    }
+}
+
 CommonUtils::CommonUtils(TestBase& tb, std::string default_clk_net)
     : tb_(tb), default_clk_net_(std::move(default_clk_net)) {}
 
 CommonUtils::RunUserTask CommonUtils::waitFor(const std::string& net,
                                               const unsigned long long val) const {
-    auto rd = tb_.getCoRead();
-    rd.read(net);
-    co_await rd;
-
-    if (rd.getNum(net) != val) {
-        auto awchange = tb_.getCoChange(net, val);
-        co_await awchange;
-    }
+    // A full-mask change wait checks the current value before suspending
+    auto awchange = tb_.getCoChange(net, ~0ULL, val);
+    co_await awchange;
     co_return;
 }
 
 CommonUtils::RunUserTask CommonUtils::clock(const int n, const int edge) const {
+    if (n <= 0) {
+        co_return;
+    }
+
+    // A Clock agent counts the edges it drives: park once on the n-th one
+    // instead of registering a value-change wait per edge.
+    if (edge == 0 || edge == 1) {
+        if (ClockEdges* edges = ClockEdges::find(default_clk_net_)) {
+            co_await edges->until(edge, edges->count(edge) + static_cast<std::uint64_t>(n));
+            co_return;
+        }
+    }
+
     for (int i = 0; i < n; ++i) {
         co_await tb_.getCoChange(default_clk_net_, edge);
     }
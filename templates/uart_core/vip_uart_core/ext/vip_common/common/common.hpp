@@ -26,8 +26,10 @@
 #ifndef VIP_COMMON_COMMON_HPP
 #define VIP_COMMON_COMMON_HPP
 
+#include <coroutine>
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include <rapidvpi/testbase/testbase.hpp>
 
@@ -39,6 +41,85 @@ namespace vip::common {
 //
 // This is intentionally lightweight and does not assume anything about
 // the user's project layout or pin-def headers.
+// Edge counters published by a Clock agent for the net it drives.
+//
+// CommonUtils::clock() parks on these instead of taking one VPI callback per
+// edge; the agent resumes the waiter right after it drives the target edge.
+// Counting driven edges keeps multi-cycle waits exact across period changes
+// and stop/start, so there is no prediction to fall back from.
+class ClockEdges {
+public:
+    explicit ClockEdges(std::string net);
+    ~ClockEdges();
+
+    ClockEdges(const ClockEdges&) = delete;
+    ClockEdges& operator=(const ClockEdges&) = delete;
+
+    // Edge source driving `net`, or nullptr if no Clock agent owns it.
+    static ClockEdges* find(const std::string& net);
+
+    // Number of edges of the given polarity driven so far (1=rise, 0=fall).
+    std::uint64_t count(int edge) const { return edge ? rises_ : falls_; }
+
+    // Waits resolved here rather than through a VPI callback.
+    std::uint64_t parked_waits() const { return parked_waits_; }
+
+    // Rise-to-rise period and tick of the latest rise, published by the owning
+    // agent so callers can lay out waveforms on future edges. The period is 0
+    // while the clock is stopped.
+    test::sim_tick_t period_ticks() const { return period_ticks_; }
+    test::sim_tick_t last_rise_tick() const { return last_rise_tick_; }
+    void set_period(test::sim_tick_t period_ticks) { period_ticks_ = period_ticks; }
+
+    // Called by the owning agent after each write to the net. Only real level
+    // changes count as edges; waiters due at the new count are resumed in order.
+    void drive(int level);
+
+    struct EdgeAwaiter {
+        ClockEdges& edges;
+        int edge;
+        std::uint64_t target;
+        std::coroutine_handle<> handle{};
+
+        bool await_ready() const noexcept { return edges.count(edge) >= target; }
+        void await_suspend(std::coroutine_handle<> h) {
+            handle = h;
+            edges.park_(edge, target, h);
+        }
+        void await_resume() const noexcept {}
+
+        // Leave the queue early, e.g. when a TaskGroup cancels the waiter
+        bool cancel() noexcept { return edges.unpark_(edge, handle); }
+    };
+
+    // Suspend until count(edge) reaches `target`.
+    EdgeAwaiter until(int edge, std::uint64_t target) { return EdgeAwaiter{*this, edge, target}; }
+
+private:
+    struct Waiter {
+        std::uint64_t target;
+        std::uint64_t seq; // FIFO order among waiters due on the same edge
+        std::coroutine_handle<> handle;
+    };
+
+    void park_(int edge, std::uint64_t target, std::coroutine_handle<> h);
+    bool unpark_(int edge, std::coroutine_handle<> h) noexcept;
+    void wake_(std::vector<Waiter>& heap, std::uint64_t now);
+
+    std::string net_;
+    int level_ = -1; // last driven level, -1 until the first write
+    std::uint64_t rises_ = 0;
+    std::uint64_t falls_ = 0;
+    std::uint64_t seq_ = 0;
+    std::uint64_t parked_waits_ = 0;
+    test::sim_tick_t period_ticks_ = 0;
+    test::sim_tick_t last_rise_tick_ = 0;
+
+    // Min-heaps on (target, seq), one per polarity
+    std::vector<Waiter> rise_waiters_;
+    std::vector<Waiter> fall_waiters_;
+};
+
 class CommonUtils {
 public:
     using RunUserTask = TestBase::RunUserTask;
@@ -50,6 +131,7 @@ public:
 
     // Wait for `n` edges of the configured default clock.
     // edge=1 waits for clock==1 transitions, edge=0 waits for clock==0.
+    // When a Clock agent drives the net, the wait costs no VPI callbacks.
     RunUserTask clock(int n = 1, int edge = 1) const;
 
     // Delay (write-phase yield) by an explicitly selected time unit.
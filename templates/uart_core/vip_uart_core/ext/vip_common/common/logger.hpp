@@ -26,7 +26,6 @@
 #ifndef VIP_COMMON_SIM_LOGGER_HPP
 #define VIP_COMMON_SIM_LOGGER_HPP
 
-#include <cmath>
 #include <cstdint>
 #include <iomanip>
 #include <limits>
@@ -137,25 +136,7 @@ public:
 template <test::TimeUnit U>
 [[nodiscard]] inline sim_tick_t duration_to_ticks(const TestBase& tb,
                                                   const test::delay_arg_t<U> delay) {
-    if constexpr (U == test::TimeUnit::ticks) {
-        return static_cast<sim_tick_t>(delay);
-    } else {
-        if (delay <= 0.0) {
-            return 0u;
-        }
-
-        const long double raw_ticks =
-            static_cast<long double>(delay) * test::TimeUnitSeconds<U>::value /
-            tb.vpiTickPeriodSeconds();
-
-        constexpr long double rel_eps = 1.0e-12L;
-        const long double nearest = std::floor(raw_ticks + 0.5L);
-        const long double diff = raw_ticks > nearest ? raw_ticks - nearest : nearest - raw_ticks;
-        const long double scale = raw_ticks > 1.0L ? raw_ticks : 1.0L;
-        const long double rounded = (diff <= rel_eps * scale) ? nearest : std::ceil(raw_ticks);
-
-        return static_cast<sim_tick_t>(rounded);
-    }
+    return tb.toTicks<U>(delay);
 }
 
 inline void log_line(const std::string& src, const std::string& level, const std::string& msg) {
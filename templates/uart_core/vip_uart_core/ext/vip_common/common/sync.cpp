@@ -0,0 +1,85 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Rovshan Rustamov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "vip_common/common/sync.hpp"
+
+namespace vip::common {
+
+void Event::set() {
+    set_ = true;
+    wake_all_();
+}
+
+void Event::pulse() {
+    wake_all_();
+}
+
+void Event::wake_all_() {
+    // Detach first: a resumed waiter may wait again (or cancel a sibling
+    // that is already on its way)
+    std::vector<std::coroutine_handle<>> ready;
+    ready.swap(waiters_);
+    for (const std::coroutine_handle<> h : ready) {
+        h.resume();
+    }
+}
+
+bool Event::drop_(const std::coroutine_handle<> h) noexcept {
+    const auto it = std::find(waiters_.begin(), waiters_.end(), h);
+    if (it == waiters_.end()) {
+        return false;
+    }
+    waiters_.erase(it);
+    return true;
+}
+
+bool Semaphore::try_acquire() {
+    if (permits_ == 0u) {
+        return false;
+    }
+    --permits_;
+    return true;
+}
+
+void Semaphore::release(std::size_t n) {
+    // Hand permits straight to waiters so a resumed one cannot be overtaken
+    while (n != 0u && !waiters_.empty()) {
+        const std::coroutine_handle<> h = waiters_.front();
+        waiters_.pop_front();
+        --n;
+        h.resume();
+    }
+    permits_ += n;
+}
+
+bool Semaphore::drop_(const std::coroutine_handle<> h) noexcept {
+    const auto it = std::find(waiters_.begin(), waiters_.end(), h);
+    if (it == waiters_.end()) {
+        return false;
+    }
+    waiters_.erase(it);
+    return true;
+}
+
+} // namespace vip::common
@@ -0,0 +1,252 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Rovshan Rustamov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// vip_common/common/sync.hpp
+#ifndef VIP_COMMON_SYNC_HPP
+#define VIP_COMMON_SYNC_HPP
+
+#include <algorithm>
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace vip::common {
+
+// Coroutine handoff without the simulator.
+//
+// Event, Semaphore and Mailbox resume their waiters directly from the call
+// that makes them runnable (set(), release(), a put or a get), so a coroutine
+// parked on one costs no VPI callback and no clock polling while it waits.
+// A resumed waiter runs inside that call until its next suspension, as a
+// ClockEdges waiter runs inside the Clock agent's edge.
+//
+// Every awaiter has cancel(), so it can be raced with whenAny/withTimeout or
+// parked in a TaskGroup task.
+
+// Level-triggered flag. wait() returns at once while the event is set.
+class Event {
+public:
+    Event() = default;
+
+    Event(const Event&) = delete;
+    Event& operator=(const Event&) = delete;
+
+    // Latch the event and resume every waiter, in wait order.
+    void set();
+    void clear() { set_ = false; }
+
+    // Resume the current waiters without latching; later waits block.
+    void pulse();
+
+    [[nodiscard]] bool is_set() const { return set_; }
+    [[nodiscard]] std::size_t waiting() const { return waiters_.size(); }
+
+    struct Awaiter {
+        Event& event;
+        std::coroutine_handle<> handle{};
+
+        bool await_ready() const noexcept { return event.set_; }
+        void await_suspend(std::coroutine_handle<> h) {
+            handle = h;
+            event.waiters_.push_back(h);
+        }
+        void await_resume() const noexcept {}
+
+        bool cancel() noexcept { return event.drop_(handle); }
+    };
+
+    Awaiter wait() { return Awaiter{*this}; }
+
+private:
+    void wake_all_();
+    bool drop_(std::coroutine_handle<> h) noexcept;
+
+    bool set_ = false;
+    std::vector<std::coroutine_handle<>> waiters_;
+};
+
+// Counting semaphore. Released permits go to waiters in arrival order
+// before anyone else can take them.
+class Semaphore {
+public:
+    explicit Semaphore(std::size_t permits = 0u) : permits_(permits) {}
+
+    Semaphore(const Semaphore&) = delete;
+    Semaphore& operator=(const Semaphore&) = delete;
+
+    bool try_acquire();
+    void release(std::size_t n = 1u);
+
+    [[nodiscard]] std::size_t available() const { return permits_; }
+    [[nodiscard]] std::size_t waiting() const { return waiters_.size(); }
+
+    struct Awaiter {
+        Semaphore& sem;
+        std::coroutine_handle<> handle{};
+
+        bool await_ready() { return sem.try_acquire(); }
+        void await_suspend(std::coroutine_handle<> h) {
+            handle = h;
+            sem.waiters_.push_back(h);
+        }
+        void await_resume() const noexcept {}
+
+        bool cancel() noexcept { return sem.drop_(handle); }
+    };
+
+    Awaiter acquire() { return Awaiter{*this}; }
+
+private:
+    bool drop_(std::coroutine_handle<> h) noexcept;
+
+    std::size_t permits_;
+    std::deque<std::coroutine_handle<>> waiters_;
+};
+
+// FIFO of items between coroutines. put() waits while `capacity` items are
+// queued (0 means unbounded), get() waits while none is. An item put while
+// a getter waits is handed to it directly.
+template <typename T>
+class Mailbox {
+public:
+    explicit Mailbox(const std::size_t capacity = 0u) : capacity_(capacity) {}
+
+    Mailbox(const Mailbox&) = delete;
+    Mailbox& operator=(const Mailbox&) = delete;
+
+    // False (and `item` untouched) when the mailbox is full.
+    bool try_put(T& item) { return offer_(item); }
+    bool try_put(T&& item) { return offer_(item); }
+
+    std::optional<T> try_get() {
+        if (items_.empty()) {
+            return std::nullopt;
+        }
+
+        std::optional<T> item{std::move(items_.front())};
+        items_.pop_front();
+
+        // The freed slot goes to the longest-blocked putter
+        if (!putters_.empty()) {
+            PutAwaiter* putter = putters_.front();
+            putters_.pop_front();
+            items_.push_back(std::move(putter->item));
+            putter->handle.resume();
+        }
+        return item;
+    }
+
+    // Drop queued items. The freed slots go to blocked putters, oldest first,
+    // as try_get() hands them over.
+    void clear() {
+        items_.clear();
+        while (!putters_.empty() && !full()) {
+            PutAwaiter* putter = putters_.front();
+            putters_.pop_front();
+            items_.push_back(std::move(putter->item));
+            putter->handle.resume();
+        }
+    }
+
+    [[nodiscard]] std::size_t size() const { return items_.size(); }
+    [[nodiscard]] bool empty() const { return items_.empty(); }
+    [[nodiscard]] bool full() const { return capacity_ != 0u && items_.size() >= capacity_; }
+    [[nodiscard]] std::size_t capacity() const { return capacity_; }
+
+    struct PutAwaiter {
+        Mailbox& box;
+        T item;
+        std::coroutine_handle<> handle{};
+
+        bool await_ready() { return box.offer_(item); }
+        void await_suspend(std::coroutine_handle<> h) {
+            handle = h;
+            box.putters_.push_back(this);
+        }
+        void await_resume() const noexcept {}
+
+        bool cancel() noexcept { return drop(box.putters_, this); }
+    };
+
+    struct GetAwaiter {
+        Mailbox& box;
+        std::optional<T> item{};
+        std::coroutine_handle<> handle{};
+
+        bool await_ready() {
+            item = box.try_get();
+            return item.has_value();
+        }
+        void await_suspend(std::coroutine_handle<> h) {
+            handle = h;
+            box.getters_.push_back(this);
+        }
+        T await_resume() { return std::move(*item); }
+
+        bool cancel() noexcept { return drop(box.getters_, this); }
+    };
+
+    PutAwaiter put(T item) { return PutAwaiter{*this, std::move(item)}; }
+    GetAwaiter get() { return GetAwaiter{*this}; }
+
+private:
+    template <typename Awaiter>
+    static bool drop(std::deque<Awaiter*>& waiters, Awaiter* awaiter) noexcept {
+        const auto it = std::find(waiters.begin(), waiters.end(), awaiter);
+        if (it == waiters.end()) {
+            return false;
+        }
+        waiters.erase(it);
+        return true;
+    }
+
+    bool offer_(T& item) {
+        // A waiting getter means nothing is queued: hand the item over
+        if (!getters_.empty()) {
+            GetAwaiter* getter = getters_.front();
+            getters_.pop_front();
+            getter->item.emplace(std::move(item));
+            getter->handle.resume();
+            return true;
+        }
+
+        if (full()) {
+            return false;
+        }
+        items_.push_back(std::move(item));
+        return true;
+    }
+
+    std::size_t capacity_;
+    std::deque<T> items_;
+    std::deque<GetAwaiter*> getters_;
+    std::deque<PutAwaiter*> putters_;
+};
+
+} // namespace vip::common
+
+#endif // VIP_COMMON_SYNC_HPP
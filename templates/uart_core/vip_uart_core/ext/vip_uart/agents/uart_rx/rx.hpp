@@ -69,6 +69,13 @@ public:
     [[nodiscard]] const UartParams& params() const { return params_; }
 
     void set_capture_enable(const std::string& port, bool en);
+
+    // Edge decoding: log rx_net value changes and rebuild each frame from the
+    // edge timestamps instead of sampling the line every clock. Sample points
+    // are laid out on the period published by a Clock agent on the clock net;
+    // without one the port keeps polling.
+    void set_edge_decode(bool en);
+    void set_edge_decode(const std::string& port, bool en);
     [[nodiscard]] std::vector<UartFrame> get_history(const std::string& port) const;
     [[nodiscard]] std::size_t history_size(const std::string& port) const;
     [[nodiscard]] std::size_t observed_count(const std::string& port) const;
@@ -82,6 +89,11 @@ public:
     RunUserTask drive_cts_now(const std::string& port, bool active);
 
 private:
+    struct LineEdge {
+        test::sim_tick_t tick;
+        bool level;
+    };
+
     struct PortState {
         UartRxPortConfig cfg;
         std::vector<UartFrame> history;
@@ -89,6 +101,12 @@ private:
         bool cts_drive_enable = false;
         bool cts_active = true;
         std::size_t observed_count = 0u;
+        bool edge_decode = false;
+        bool edge_watch = false; // edge logger keeps recording while set
+        bool edge_watch_running = false;
+        bool line_held = false; // line still at start level when the last frame ended
+        test::sim_tick_t edge_cursor = 0u; // end of the last decoded frame
+        std::vector<LineEdge> edges;
     };
 
     TestBase& tb_;
@@ -114,6 +132,13 @@ private:
     RunUserTask reset_asserted_(bool& asserted);
     RunUserTask drive_cts_(PortState& port);
     RunUserTask capture_frame_(PortState& port, UartFrame& frame);
+    void publish_frame_(PortState& port, const UartFrame& frame);
+
+    RunTask watch_line_(PortState& port);
+    RunUserTask decode_edge_frame_(PortState& port, const vip::common::ClockEdges& clk);
+    [[nodiscard]] bool line_level_(const PortState& port,
+                                   test::sim_tick_t start_tick,
+                                   test::sim_tick_t tick) const;
 };
 
 } // namespace vip::uart
@@ -103,6 +103,16 @@ void UartRx::set_capture_enable(const std::string& port, const bool en) {
     port_(port).capture_enable = en;
 }
 
+void UartRx::set_edge_decode(const bool en) {
+    for (auto& port : ports_) {
+        port.edge_decode = en;
+    }
+}
+
+void UartRx::set_edge_decode(const std::string& port, const bool en) {
+    port_(port).edge_decode = en;
+}
+
 std::vector<UartFrame> UartRx::get_history(const std::string& port) const {
     return port_(port).history;
 }
@@ -24,6 +24,8 @@
 
 #include "vip_uart/agents/uart_rx/rx.hpp"
 
+#include <algorithm>
+
 #include "vip_common/common/logger.hpp"
 
 namespace vip::uart {
@@ -37,6 +39,16 @@ UartRx::RunTask UartRx::agent(const unsigned idx) {
     co_await drive_cts_(port);
 
     for (;;) {
+        if (port.edge_decode) {
+            const auto* clk = vip::common::ClockEdges::find(clock_net_);
+            if (clk != nullptr && clk->period_ticks() != 0u) {
+                co_await decode_edge_frame_(port, *clk);
+                continue;
+            }
+        }
+        port.edge_watch = false;
+        port.line_held = false;
+
         co_await drive_cts_(port);
 
         bool in_reset = false;
@@ -55,27 +67,30 @@ UartRx::RunTask UartRx::agent(const unsigned idx) {
 
         UartFrame frame;
         co_await capture_frame_(port, frame);
+        publish_frame_(port, frame);
+    }
 
-        port.observed_count++;
-        if (port.capture_enable) {
-            port.history.push_back(frame);
-        }
-        if (scb_stream_ != nullptr) {
-            scb_stream_->observe_frame(port.cfg.name, frame);
-        }
-        if (scb_rules_ != nullptr) {
-            scb_rules_->observe_frame(port.cfg.name, frame);
-        }
+    co_return;
+}
 
-        if (verbose_) {
-            vip::common::log_line("vip_uart_rx",
-                                  "INFO",
-                                  port.cfg.name + " observed byte "
-                                      + std::to_string(static_cast<unsigned>(frame.data)));
-        }
+void UartRx::publish_frame_(PortState& port, const UartFrame& frame) {
+    port.observed_count++;
+    if (port.capture_enable) {
+        port.history.push_back(frame);
+    }
+    if (scb_stream_ != nullptr) {
+        scb_stream_->observe_frame(port.cfg.name, frame);
+    }
+    if (scb_rules_ != nullptr) {
+        scb_rules_->observe_frame(port.cfg.name, frame);
     }
 
-    co_return;
+    if (verbose_) {
+        vip::common::log_line("vip_uart_rx",
+                              "INFO",
+                              port.cfg.name + " observed byte "
+                                  + std::to_string(static_cast<unsigned>(frame.data)));
+    }
 }
 
 UartRx::RunUserTask UartRx::wait_clks_(const unsigned clks) {
@@ -184,4 +199,149 @@ UartRx::RunUserTask UartRx::capture_frame_(PortState& port, UartFrame& frame) {
     co_return;
 }
 
+UartRx::RunTask UartRx::watch_line_(PortState& port) {
+    while (port.edge_watch) {
+        auto c = tb_.getCoChange(port.cfg.rx_net);
+        co_await c;
+        if (!port.edge_watch) {
+            break;
+        }
+        port.edges.push_back(LineEdge{c.getTime<test::ticks>(), (c.getNum() & 1u) != 0u});
+    }
+    port.edge_watch_running = false;
+    co_return;
+}
+
+bool UartRx::line_level_(const PortState& port,
+                         const test::sim_tick_t start_tick,
+                         const test::sim_tick_t tick) const {
+    // The line is at start level from the start edge until the next logged edge
+    bool level = !params_.idle_high;
+    for (const auto& edge : port.edges) {
+        if (edge.tick <= start_tick) {
+            continue;
+        }
+        if (edge.tick > tick) {
+            break;
+        }
+        level = edge.level;
+    }
+    return level;
+}
+
+UartRx::RunUserTask UartRx::decode_edge_frame_(PortState& port,
+                                               const vip::common::ClockEdges& clk) {
+    co_await drive_cts_(port);
+
+    const bool start_level = !params_.idle_high;
+    const bool stop_level = params_.idle_high;
+
+    port.edge_watch = true;
+    if (!port.edge_watch_running) {
+        port.edge_watch_running = true;
+        watch_line_(port);
+    }
+
+    // A line still low at the end of the last frame starts the next one at
+    // once, as the polling decoder would; otherwise take the first start edge
+    // past the last frame, logged already or still to come
+    test::sim_tick_t start_edge = port.edge_cursor;
+    if (!port.line_held) {
+        const auto it = std::find_if(port.edges.begin(), port.edges.end(), [&](const LineEdge& e) {
+            return e.tick > port.edge_cursor && e.level == start_level;
+        });
+        if (it != port.edges.end()) {
+            start_edge = it->tick;
+        } else {
+            auto c = tb_.getCoChange(port.cfg.rx_net, start_level ? 1u : 0u);
+            co_await c;
+            start_edge = c.getTime<test::ticks>();
+        }
+    }
+
+    bool in_reset = false;
+    co_await reset_asserted_(in_reset);
+    if (in_reset) {
+        port.line_held = false;
+        port.edges.clear();
+        port.edge_cursor = vip::common::sim_time_ticks();
+        co_await wait_clks_(params_.idle_poll_clks);
+        co_return;
+    }
+
+    // Sample i sits on the rising edge capture_frame_ would sample at. The
+    // poller sees the start bit at the first rise at or after the start edge
+    // (R0) and then counts sample_clk_index rises from R0 + period, then every
+    // bit_clks rises. The published clock period is assumed to hold for the
+    // whole frame.
+    const test::sim_tick_t period = clk.period_ticks();
+    const test::sim_tick_t last_rise = clk.last_rise_tick();
+    const test::sim_tick_t phase = start_edge >= last_rise
+        ? (start_edge - last_rise) % period
+        : (period - (last_rise - start_edge) % period) % period;
+    const test::sim_tick_t seen_rise = start_edge + (phase == 0u ? 0u : period - phase);
+    const test::sim_tick_t first_rise = seen_rise + period;
+    const test::sim_tick_t first_clks = params_.sample_clk_index == 0u ? 1u : params_.sample_clk_index;
+    const test::sim_tick_t bit_clks = params_.bit_clks == 0u ? 1u : params_.bit_clks;
+    const auto sample_tick = [&](const unsigned i) {
+        return first_rise + (first_clks - 1u + i * bit_clks) * period;
+    };
+
+    const unsigned parity_bits = params_.parity_enable() ? 1u : 0u;
+    const unsigned samples = 1u + params_.data_bits + parity_bits + params_.stop_bits;
+    const test::sim_tick_t end_tick = sample_tick(samples - 1u);
+
+    // One read-only sync at the last stop sample, once its edges are logged
+    const test::sim_tick_t now = vip::common::sim_time_ticks();
+    auto r = tb_.getCoRead<test::ticks>(end_tick > now ? end_tick - now : 0u);
+    co_await r;
+
+    UartFrame frame;
+    frame.data_bits = params_.data_bits;
+    frame.stop_bits = params_.stop_bits;
+    frame.parity = params_.parity;
+    frame.start_tick = sample_tick(0u);
+    frame.end_tick = end_tick;
+
+    unsigned idx = 0u;
+    if (line_level_(port, start_edge, sample_tick(idx++)) != start_level) {
+        frame.framing_error = true;
+    }
+
+    std::uint8_t data = 0u;
+    for (unsigned bit = 0u; bit < params_.data_bits; ++bit) {
+        const unsigned dst_bit = params_.lsb_first ? bit : (params_.data_bits - 1u - bit);
+        if (line_level_(port, start_edge, sample_tick(idx++))) {
+            data = static_cast<std::uint8_t>(data | static_cast<std::uint8_t>(1u << dst_bit));
+        }
+    }
+    frame.data = static_cast<std::uint8_t>(data & params_.data_mask());
+
+    if (params_.parity_enable()) {
+        const bool expected = uart_parity_bit(frame.data, params_);
+        frame.parity_error = line_level_(port, start_edge, sample_tick(idx++)) != expected;
+    }
+
+    bool all_stop_low = true;
+    bool last_level = stop_level;
+    for (unsigned stop = 0u; stop < params_.stop_bits; ++stop) {
+        last_level = line_level_(port, start_edge, sample_tick(idx++));
+        if (last_level != stop_level) {
+            frame.framing_error = true;
+        }
+        all_stop_low = all_stop_low && (last_level == start_level);
+    }
+
+    frame.break_detect = frame.framing_error
+        && frame.data == 0u
+        && all_stop_low;
+
+    port.line_held = last_level == start_level;
+    port.edge_cursor = end_tick;
+    std::erase_if(port.edges, [end_tick](const LineEdge& e) { return e.tick <= end_tick; });
+
+    publish_frame_(port, frame);
+    co_return;
+}
+
 } // namespace vip::uart
@@ -33,6 +33,7 @@
 #include <vector>
 
 #include "vip_common/common/common.hpp"
+#include "vip_common/common/sync.hpp"
 #include "vip_uart/common/uart_params.hpp"
 #include "vip_uart/common/uart_types.hpp"
 #include "vip_uart/scoreboard/uart_scb/scb_uart_rules.hpp"
@@ -71,6 +72,13 @@ public:
     void set_auto_expect(bool en);
     void set_auto_expect(const std::string& port, bool en);
 
+    // Frame-waveform mode: lay out every line transition of a frame up front
+    // as delayed puts and wake once at frame end. Clock-counted bits need a
+    // Clock agent on the clock net (its published period is assumed to hold
+    // for the frame); otherwise the frame is driven bit by bit.
+    void set_frame_waveform(bool en);
+    void set_frame_waveform(const std::string& port, bool en);
+
     unsigned enqueue_byte(const std::string& port, std::uint8_t data);
     unsigned enqueue_bytes(const std::string& port, const std::vector<std::uint8_t>& data);
     unsigned enqueue_byte_with_phase(const std::string& port,
@@ -106,7 +114,7 @@ private:
         bool force_bad_parity = false;
         bool use_time_delay = false;
         bool align_to_clock_phase = false;
-        double bit_time_ns = 0.0;
+        test::sim_tick_t bit_ticks = 0u; // converted once at enqueue
         std::uint64_t phase_offset_ps = 0u;
     };
 
@@ -120,6 +128,17 @@ private:
         bool auto_expect = false;
         bool next_bad_stop = false;
         bool next_bad_parity = false;
+        bool frame_waveform = false;
+        std::vector<test::WaveStep> wave_steps; // reused frame to frame
+        vip::common::Event work; // pulsed on enqueue, wakes this port's idle agent
+    };
+
+    // Line levels of one frame in send order: bit i of `levels` is bit i
+    struct FrameLevels {
+        std::uint32_t levels = 0u;
+        unsigned count = 0u;
+
+        [[nodiscard]] bool level(const unsigned i) const { return ((levels >> i) & 1u) != 0u; }
     };
 
     TestBase& tb_;
@@ -128,9 +147,10 @@ private:
     std::string reset_net_;
     bool reset_active_low_ = true;
     UartParams params_;
-    std::vector<PortState> ports_;
+    std::deque<PortState> ports_; // a deque: PortState holds a non-movable Event
     std::unordered_map<std::string, std::size_t> port_index_;
     std::unordered_map<unsigned, bool> ticket_done_;
+    vip::common::Event done_; // pulsed when a frame finishes, wakes wait_done
     unsigned next_ticket_ = 1u;
     bool verbose_ = false;
 
@@ -141,9 +161,15 @@ private:
     const PortState& port_(const std::string& name) const;
 
     TxItem make_item_(PortState& port, std::uint8_t data);
-    static double baud_to_bit_time_ns_(std::uint64_t baud_rate);
+    test::sim_tick_t baud_to_bit_ticks_(std::uint64_t baud_rate) const;
+
+    [[nodiscard]] FrameLevels frame_levels_(const TxItem& item) const;
+    bool frame_bit_ticks_(const TxItem& item, test::sim_tick_t& first_ticks,
+                          test::sim_tick_t& bit_ticks) const;
 
     RunUserTask drive_line_(PortState& port, bool logical_level);
+    RunUserTask drive_frame_waveform_(PortState& port, const FrameLevels& frame,
+                                      test::sim_tick_t first_ticks, test::sim_tick_t bit_ticks);
     RunUserTask wait_clks_(unsigned clks);
     RunUserTask wait_item_bit_(const TxItem& item);
     RunUserTask read_bit_(const std::string& net, bool& value);
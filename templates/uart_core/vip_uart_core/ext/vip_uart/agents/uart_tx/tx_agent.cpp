@@ -24,6 +24,7 @@
 
 #include "vip_uart/agents/uart_tx/tx.hpp"
 
+#include <chrono>
 #include <stdexcept>
 #include <utility>
 
@@ -45,7 +46,6 @@ UartTx::UartTx(TestBase& tb,
         throw std::invalid_argument("vip_uart UartTx invalid UartParams");
     }
 
-    ports_.reserve(ports.size());
     for (auto& cfg : ports) {
         if (cfg.name.empty() || cfg.tx_net.empty()) {
             throw std::invalid_argument("vip_uart UartTx port requires name and tx_net");
@@ -57,12 +57,11 @@ UartTx::UartTx(TestBase& tb,
             cfg.rts_active_low = params_.rts_active_low;
         }
 
-        PortState state;
+        const std::size_t idx = ports_.size();
+        PortState& state = ports_.emplace_back();
         state.respect_rts = cfg.use_rts;
         state.cfg = std::move(cfg);
-        const std::size_t idx = ports_.size();
         port_index_[state.cfg.name] = idx;
-        ports_.push_back(std::move(state));
     }
 }
 
@@ -99,6 +98,7 @@ void UartTx::reset_case() {
         port.next_bad_parity = false;
     }
     ticket_done_.clear();
+    done_.pulse();
 }
 
 void UartTx::set_auto_expect(const bool en) {
@@ -111,10 +111,22 @@ void UartTx::set_auto_expect(const std::string& port, const bool en) {
     port_(port).auto_expect = en;
 }
 
+void UartTx::set_frame_waveform(const bool en) {
+    for (auto& port : ports_) {
+        port.frame_waveform = en;
+    }
+}
+
+void UartTx::set_frame_waveform(const std::string& port, const bool en) {
+    port_(port).frame_waveform = en;
+}
+
 unsigned UartTx::enqueue_byte(const std::string& port_name, const std::uint8_t data) {
     auto& port = port_(port_name);
     port.pending.push_back(make_item_(port, data));
-    return port.pending.back().ticket;
+    const unsigned ticket = port.pending.back().ticket;
+    port.work.pulse();
+    return ticket;
 }
 
 unsigned UartTx::enqueue_bytes(const std::string& port,
@@ -134,10 +146,11 @@ unsigned UartTx::enqueue_byte_with_phase(const std::string& port_name,
     TxItem item = make_item_(port, data);
     item.use_time_delay = true;
     item.align_to_clock_phase = true;
-    item.bit_time_ns = baud_to_bit_time_ns_(baud_rate);
+    item.bit_ticks = baud_to_bit_ticks_(baud_rate);
     item.phase_offset_ps = phase_offset_ps;
 
     port.pending.push_back(item);
+    port.work.pulse();
     return item.ticket;
 }
 
@@ -146,7 +159,7 @@ unsigned UartTx::enqueue_bytes_with_phase(const std::string& port_name,
                                           const std::uint64_t baud_rate,
                                           const std::uint64_t initial_phase_offset_ps) {
     auto& port = port_(port_name);
-    const double bit_time_ns = baud_to_bit_time_ns_(baud_rate);
+    const test::sim_tick_t bit_ticks = baud_to_bit_ticks_(baud_rate);
 
     unsigned last = 0u;
     bool first = true;
@@ -154,7 +167,7 @@ unsigned UartTx::enqueue_bytes_with_phase(const std::string& port_name,
         TxItem item = make_item_(port, byte);
         item.use_time_delay = true;
         item.align_to_clock_phase = first;
-        item.bit_time_ns = bit_time_ns;
+        item.bit_ticks = bit_ticks;
         item.phase_offset_ps = first ? initial_phase_offset_ps : 0u;
         first = false;
 
@@ -162,6 +175,7 @@ unsigned UartTx::enqueue_bytes_with_phase(const std::string& port_name,
         port.pending.push_back(item);
     }
 
+    port.work.pulse();
     return last;
 }
 
@@ -187,20 +201,20 @@ UartTx::TxItem UartTx::make_item_(PortState& port, const std::uint8_t data) {
     return item;
 }
 
-double UartTx::baud_to_bit_time_ns_(const std::uint64_t baud_rate) {
+test::sim_tick_t UartTx::baud_to_bit_ticks_(const std::uint64_t baud_rate) const {
     if (baud_rate == 0u) {
         throw std::invalid_argument("vip_uart UartTx phase send requires nonzero baud_rate");
     }
-    return 1'000'000'000.0 / static_cast<double>(baud_rate);
+    // One bit is ceil(ticks_per_second / baud) raw ticks, in integers
+    const test::sim_tick_t ticks_per_second = tb_.toTicks(std::chrono::seconds(1));
+    return ticks_per_second / baud_rate + (ticks_per_second % baud_rate != 0u ? 1u : 0u);
 }
 
 UartTx::RunUserTask UartTx::wait_done(const unsigned ticket) {
-    if (ticket_done_.find(ticket) == ticket_done_.end()) {
-        co_return;
-    }
-
-    while (!is_done(ticket)) {
-        co_await wait_clks_(params_.idle_poll_clks);
+    // Woken by the agent as frames finish; a ticket dropped by reset_case
+    // ends the wait too
+    while (ticket_done_.find(ticket) != ticket_done_.end() && !is_done(ticket)) {
+        co_await done_.wait();
     }
     co_return;
 }
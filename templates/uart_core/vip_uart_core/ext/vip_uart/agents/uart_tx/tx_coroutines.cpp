@@ -46,6 +46,9 @@ UartTx::RunTask UartTx::agent(const unsigned idx) {
         }
 
         if (port.pending.empty()) {
+            // Sleep without simulator callbacks until something is queued,
+            // then start on a clock edge as before
+            co_await port.work.wait();
             co_await wait_clks_(params_.idle_poll_clks);
             continue;
         }
@@ -61,6 +64,7 @@ UartTx::RunTask UartTx::agent(const unsigned idx) {
         port.pending.pop_front();
         co_await send_item_(port, item);
         ticket_done_[item.ticket] = true;
+        done_.pulse();
 
         if (port.inter_frame_gap_clks != 0u) {
             co_await wait_clks_(port.inter_frame_gap_clks);
@@ -77,6 +81,87 @@ UartTx::RunUserTask UartTx::drive_line_(PortState& port, const bool logical_leve
     co_return;
 }
 
+UartTx::FrameLevels UartTx::frame_levels_(const TxItem& item) const {
+    FrameLevels frame;
+    const auto push = [&frame](const bool level) {
+        frame.levels |= (level ? 1u : 0u) << frame.count;
+        ++frame.count;
+    };
+
+    push(!params_.idle_high);
+
+    for (unsigned bit = 0u; bit < params_.data_bits; ++bit) {
+        const unsigned src_bit = params_.lsb_first ? bit : (params_.data_bits - 1u - bit);
+        push(((item.frame.data >> src_bit) & 1u) != 0u);
+    }
+
+    if (params_.parity_enable()) {
+        const bool parity_bit = uart_parity_bit(item.frame.data, params_);
+        push(item.force_bad_parity ? !parity_bit : parity_bit);
+    }
+
+    for (unsigned stop = 0u; stop < params_.stop_bits; ++stop) {
+        push(item.force_bad_stop ? !params_.idle_high : params_.idle_high);
+    }
+
+    return frame;
+}
+
+bool UartTx::frame_bit_ticks_(const TxItem& item,
+                              test::sim_tick_t& first_ticks,
+                              test::sim_tick_t& bit_ticks) const {
+    if (item.use_time_delay) {
+        first_ticks = item.bit_ticks;
+        bit_ticks = item.bit_ticks;
+        return bit_ticks != 0u;
+    }
+
+    // Clock-counted bits end on rising edges, so the start bit runs to the
+    // bit_clks-th rise after the latest one, as wait_clks_ would
+    const auto* edges = vip::common::ClockEdges::find(clock_net_);
+    if (edges == nullptr || edges->period_ticks() == 0u) {
+        return false;
+    }
+
+    const unsigned clks = params_.bit_clks == 0u ? 1u : params_.bit_clks;
+    bit_ticks = edges->period_ticks() * clks;
+
+    const test::sim_tick_t now = vip::common::sim_time_ticks();
+    const test::sim_tick_t first_end = edges->last_rise_tick() + bit_ticks;
+    if (first_end <= now) {
+        return false;
+    }
+    first_ticks = first_end - now;
+    return true;
+}
+
+UartTx::RunUserTask UartTx::drive_frame_waveform_(PortState& port,
+                                                  const FrameLevels& frame,
+                                                  const test::sim_tick_t first_ticks,
+                                                  const test::sim_tick_t bit_ticks) {
+    // Runs of equal bits share one transition; the return to idle is always
+    // scheduled so the wait ends with the last stop bit
+    auto& steps = port.wave_steps;
+    steps.clear();
+
+    test::sim_tick_t delta = 0u;
+    int level = -1;
+    for (unsigned i = 0u; i <= frame.count; ++i) {
+        const bool next = i < frame.count ? frame.level(i) : params_.idle_high;
+        if (static_cast<int>(next) != level || i == frame.count) {
+            steps.push_back(test::WaveStep{delta, next ? 1u : 0u});
+            delta = 0u;
+            level = next ? 1 : 0;
+        }
+        if (i < frame.count) {
+            delta += i == 0u ? first_ticks : bit_ticks;
+        }
+    }
+
+    co_await tb_.scheduleWaveform(port.cfg.tx_net, steps);
+    co_return;
+}
+
 UartTx::RunUserTask UartTx::wait_clks_(const unsigned clks) {
     const unsigned n = clks == 0u ? 1u : clks;
     co_await utils_.clock(static_cast<int>(n), 1);
@@ -85,7 +170,7 @@ UartTx::RunUserTask UartTx::wait_clks_(const unsigned clks) {
 
 UartTx::RunUserTask UartTx::wait_item_bit_(const TxItem& item) {
     if (item.use_time_delay) {
-        co_await utils_.delay<test::ns>(item.bit_time_ns);
+        co_await utils_.delay<test::ticks>(item.bit_ticks);
     } else {
         co_await wait_clks_(params_.bit_clks);
     }
@@ -147,9 +232,6 @@ UartTx::RunUserTask UartTx::wait_rts_active_(PortState& port, bool& active) {
 UartTx::RunUserTask UartTx::send_item_(PortState& port, TxItem item) {
     UartFrame sent = item.frame;
 
-    const bool start_level = !params_.idle_high;
-    const bool stop_level = params_.idle_high;
-
     if (item.use_time_delay && item.align_to_clock_phase) {
         co_await utils_.clock_to_write(1, 1);
         if (item.phase_offset_ps != 0u) {
@@ -158,32 +240,20 @@ UartTx::RunUserTask UartTx::send_item_(PortState& port, TxItem item) {
     }
 
     sent.start_tick = vip::common::sim_time_ticks();
-    co_await drive_line_(port, start_level);
-    co_await wait_item_bit_(item);
+    const FrameLevels frame = frame_levels_(item);
 
-    for (unsigned bit = 0u; bit < params_.data_bits; ++bit) {
-        const unsigned src_bit = params_.lsb_first ? bit : (params_.data_bits - 1u - bit);
-        const bool value = ((sent.data >> src_bit) & 1u) != 0u;
-        co_await drive_line_(port, value);
-        co_await wait_item_bit_(item);
-    }
-
-    if (params_.parity_enable()) {
-        bool parity_bit = uart_parity_bit(sent.data, params_);
-        if (item.force_bad_parity) {
-            parity_bit = !parity_bit;
+    test::sim_tick_t first_ticks = 0u;
+    test::sim_tick_t bit_ticks = 0u;
+    if (port.frame_waveform && frame_bit_ticks_(item, first_ticks, bit_ticks)) {
+        co_await drive_frame_waveform_(port, frame, first_ticks, bit_ticks);
+    } else {
+        for (unsigned i = 0u; i < frame.count; ++i) {
+            co_await drive_line_(port, frame.level(i));
+            co_await wait_item_bit_(item);
         }
-        co_await drive_line_(port, parity_bit);
-        co_await wait_item_bit_(item);
+        co_await drive_line_(port, params_.idle_high);
     }
 
-    for (unsigned stop = 0u; stop < params_.stop_bits; ++stop) {
-        const bool stop_bit = item.force_bad_stop ? !stop_level : stop_level;
-        co_await drive_line_(port, stop_bit);
-        co_await wait_item_bit_(item);
-    }
-
-    co_await drive_line_(port, params_.idle_high);
     sent.end_tick = vip::common::sim_time_ticks();
     port.history.push_back(sent);
 
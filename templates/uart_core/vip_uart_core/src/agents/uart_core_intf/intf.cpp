@@ -25,6 +25,7 @@
 #include "agents/uart_core_intf/intf.hpp"
 
 #include <utility>
+#include <vector>
 
 #include "pindefs.hpp"
 #include "scoreboard/scb_uart_core.hpp"
@@ -66,11 +67,11 @@ UartCoreIntf::RunTask UartCoreIntf::monitor_events() {
             continue;
         }
 
-        event_counts_.rx_overrun += (r.getNum(event_rx_overrun) & 1u) != 0u ? 1u : 0u;
-        event_counts_.rx_frame_error += (r.getNum(event_rx_frame_error) & 1u) != 0u ? 1u : 0u;
-        event_counts_.rx_parity_error += (r.getNum(event_rx_parity_error) & 1u) != 0u ? 1u : 0u;
-        event_counts_.rx_break_detect += (r.getNum(event_rx_break_detect) & 1u) != 0u ? 1u : 0u;
-        event_counts_.tx_done += (r.getNum(event_tx_done) & 1u) != 0u ? 1u : 0u;
+        event_counts_.rx_overrun += r.getNum(event_rx_overrun) ? 1u : 0u;
+        event_counts_.rx_frame_error += r.getNum(event_rx_frame_error) ? 1u : 0u;
+        event_counts_.rx_parity_error += r.getNum(event_rx_parity_error) ? 1u : 0u;
+        event_counts_.rx_break_detect += r.getNum(event_rx_break_detect) ? 1u : 0u;
+        event_counts_.tx_done += r.getNum(event_tx_done) ? 1u : 0u;
     }
 
     co_return;
@@ -131,7 +132,6 @@ UartCoreIntf::RunUserTask UartCoreIntf::try_push_tx_byte(const std::uint8_t data
                                                          bool& accepted,
                                                          const unsigned timeout_cycles) {
     accepted = false;
-    bool at_low_phase = true;
 
     co_await utils_.clock_to_write(1, 0);
     co_await write_tx_valid_(false, data);
@@ -139,29 +139,16 @@ UartCoreIntf::RunUserTask UartCoreIntf::try_push_tx_byte(const std::uint8_t data
     co_await utils_.write_barrier();
     co_await write_tx_valid_(true, data);
 
-    for (unsigned cycle = 0u; cycle < timeout_cycles; ++cycle) {
-        auto r = tb_.getCoRead();
-        r.read(tx_byte_ready);
-        co_await r;
-
-        const bool ready_for_edge = (r.getNum(tx_byte_ready) & 1u) != 0u;
+    // Only this push can take tx_byte_ready low again, so once it is high
+    // the byte is taken on the next rising edge
+    auto ready = tb_.getCoChange(tx_byte_ready, 1u, 1u);
+    if (co_await tb_.withTimeout<test::ns>(ready, CLK_PERIOD_NS * timeout_cycles)
+        == TimeoutResult::fired) {
         co_await utils_.clock(1, 1);
-        at_low_phase = false;
-
-        if (ready_for_edge) {
-            accepted = true;
-            break;
-        }
-
-        co_await utils_.clock(1, 0);
-        at_low_phase = true;
+        accepted = true;
     }
 
-    if (!at_low_phase) {
-        co_await utils_.clock_to_write(1, 0);
-    } else {
-        co_await utils_.write_barrier();
-    }
+    co_await utils_.clock_to_write(1, 0);
     co_await write_tx_valid_(false, data);
 
     co_return;
@@ -178,7 +165,10 @@ UartCoreIntf::RunUserTask UartCoreIntf::pop_rx_byte(UartCoreRxByte& rec,
         co_await w;
     }
 
-    for (unsigned cycle = 0u; cycle < timeout_cycles; ++cycle) {
+    // Sleep until rx_byte_valid rises instead of reading it every cycle
+    auto valid = tb_.getCoChange(rx_byte_valid, 1u, 1u);
+    if (co_await tb_.withTimeout<test::ns>(valid, CLK_PERIOD_NS * timeout_cycles)
+        == TimeoutResult::fired) {
         auto r = tb_.getCoRead();
         r.read(rx_byte_valid);
         r.read(rx_byte_data);
@@ -187,17 +177,12 @@ UartCoreIntf::RunUserTask UartCoreIntf::pop_rx_byte(UartCoreRxByte& rec,
         r.read(rx_byte_break_detect);
         co_await r;
 
-        if ((r.getNum(rx_byte_valid) & 1u) != 0u) {
-            rec.valid = true;
-            rec.data = static_cast<std::uint8_t>(r.getNum(rx_byte_data) & 0xffu);
-            rec.frame_error = (r.getNum(rx_byte_frame_error) & 1u) != 0u;
-            rec.parity_error = (r.getNum(rx_byte_parity_error) & 1u) != 0u;
-            rec.break_detect = (r.getNum(rx_byte_break_detect) & 1u) != 0u;
-            rec.time_tick = r.getTime<test::ticks>();
-            break;
-        }
-
-        co_await utils_.clock(1, 1);
+        rec.valid = r.getNum(rx_byte_valid);
+        rec.data = r.getNum(rx_byte_data);
+        rec.frame_error = r.getNum(rx_byte_frame_error);
+        rec.parity_error = r.getNum(rx_byte_parity_error);
+        rec.break_detect = r.getNum(rx_byte_break_detect);
+        rec.time_tick = r.getTime<test::ticks>();
     }
 
     if (rec.valid) {
@@ -232,7 +217,7 @@ UartCoreIntf::RunUserTask UartCoreIntf::pop_rx_byte(UartCoreRxByte& rec,
 UartCoreIntf::RunUserTask UartCoreIntf::set_rx_ready(const bool ready) {
     co_await utils_.clock_to_write(1, 0);
     auto w = tb_.getCoWrite();
-    w.write(rx_byte_ready, ready ? 1 : 0);
+    w.write(rx_byte_ready, ready);
     co_await w;
     co_return;
 }
@@ -259,36 +244,90 @@ UartCoreIntf::RunUserTask UartCoreIntf::sample_status(UartCoreStatus& status) {
     r.read(event_tx_done);
     co_await r;
 
-    status.tx_byte_ready = (r.getNum(tx_byte_ready) & 1u) != 0u;
-    status.rx_byte_valid = (r.getNum(rx_byte_valid) & 1u) != 0u;
+    status.tx_byte_ready = r.getNum(tx_byte_ready);
+    status.rx_byte_valid = r.getNum(rx_byte_valid);
     status.rx_level = static_cast<unsigned>(r.getNum(rx_fifo_level));
     status.tx_level = static_cast<unsigned>(r.getNum(tx_fifo_level));
-    status.rx_empty = (r.getNum(rx_fifo_empty) & 1u) != 0u;
-    status.rx_full = (r.getNum(rx_fifo_full) & 1u) != 0u;
-    status.tx_empty = (r.getNum(tx_fifo_empty) & 1u) != 0u;
-    status.tx_full = (r.getNum(tx_fifo_full) & 1u) != 0u;
-    status.rx_busy = (r.getNum(rx_busy) & 1u) != 0u;
-    status.tx_busy = (r.getNum(tx_busy) & 1u) != 0u;
-    status.cts_active = (r.getNum(cts_active) & 1u) != 0u;
-    status.rts_active = (r.getNum(rts_active) & 1u) != 0u;
-    status.cts_blocked = (r.getNum(cts_blocked) & 1u) != 0u;
-    status.event_rx_overrun = (r.getNum(event_rx_overrun) & 1u) != 0u;
-    status.event_rx_frame_error = (r.getNum(event_rx_frame_error) & 1u) != 0u;
-    status.event_rx_parity_error = (r.getNum(event_rx_parity_error) & 1u) != 0u;
-    status.event_rx_break_detect = (r.getNum(event_rx_break_detect) & 1u) != 0u;
-    status.event_tx_done = (r.getNum(event_tx_done) & 1u) != 0u;
+    status.rx_empty = r.getNum(rx_fifo_empty);
+    status.rx_full = r.getNum(rx_fifo_full);
+    status.tx_empty = r.getNum(tx_fifo_empty);
+    status.tx_full = r.getNum(tx_fifo_full);
+    status.rx_busy = r.getNum(rx_busy);
+    status.tx_busy = r.getNum(tx_busy);
+    status.cts_active = r.getNum(cts_active);
+    status.rts_active = r.getNum(rts_active);
+    status.cts_blocked = r.getNum(cts_blocked);
+    status.event_rx_overrun = r.getNum(event_rx_overrun);
+    status.event_rx_frame_error = r.getNum(event_rx_frame_error);
+    status.event_rx_parity_error = r.getNum(event_rx_parity_error);
+    status.event_rx_break_detect = r.getNum(event_rx_break_detect);
+    status.event_tx_done = r.getNum(event_tx_done);
     co_return;
 }
 
-UartCoreIntf::RunUserTask UartCoreIntf::wait_tx_idle(const unsigned timeout_cycles) {
-    for (unsigned cycle = 0u; cycle < timeout_cycles; ++cycle) {
-        co_await utils_.clock(1, 1);
+TestBase::AwaitWatch UartCoreIntf::watch_status(std::function<bool(const UartCoreStatus&)> pred,
+                                                UartCoreStatus& status) {
+    // Same order as decode_status_
+    std::vector<Net> nets{
+        tx_byte_ready.net(),
+        rx_byte_valid.net(),
+        rx_fifo_level.net(),
+        tx_fifo_level.net(),
+        rx_fifo_empty.net(),
+        rx_fifo_full.net(),
+        tx_fifo_empty.net(),
+        tx_fifo_full.net(),
+        rx_busy.net(),
+        tx_busy.net(),
+        cts_active.net(),
+        rts_active.net(),
+        cts_blocked.net(),
+        event_rx_overrun.net(),
+        event_rx_frame_error.net(),
+        event_rx_parity_error.net(),
+        event_rx_break_detect.net(),
+        event_tx_done.net(),
+    };
+
+    return tb_.getCoWatch(std::move(nets),
+                          [pred = std::move(pred), &status](std::span<const unsigned long long int> values) {
+                              decode_status_(values, status);
+                              return pred(status);
+                          });
+}
 
-        UartCoreStatus status{};
-        co_await sample_status(status);
-        if (status.tx_empty && !status.tx_busy) {
-            co_return;
-        }
+void UartCoreIntf::decode_status_(const std::span<const unsigned long long int> values,
+                                  UartCoreStatus& status) {
+    status.tx_byte_ready = values[0] != 0u;
+    status.rx_byte_valid = values[1] != 0u;
+    status.rx_level = static_cast<unsigned>(values[2]);
+    status.tx_level = static_cast<unsigned>(values[3]);
+    status.rx_empty = values[4] != 0u;
+    status.rx_full = values[5] != 0u;
+    status.tx_empty = values[6] != 0u;
+    status.tx_full = values[7] != 0u;
+    status.rx_busy = values[8] != 0u;
+    status.tx_busy = values[9] != 0u;
+    status.cts_active = values[10] != 0u;
+    status.rts_active = values[11] != 0u;
+    status.cts_blocked = values[12] != 0u;
+    status.event_rx_overrun = values[13] != 0u;
+    status.event_rx_frame_error = values[14] != 0u;
+    status.event_rx_parity_error = values[15] != 0u;
+    status.event_rx_break_detect = values[16] != 0u;
+    status.event_tx_done = values[17] != 0u;
+}
+
+UartCoreIntf::RunUserTask UartCoreIntf::wait_tx_idle(const unsigned timeout_cycles) {
+    co_await utils_.clock(1, 1);
+
+    auto idle = tb_.getCoWatch({tx_fifo_empty.net(), tx_busy.net()},
+                               [](const std::span<const unsigned long long int> values) {
+                                   return values[0] != 0u && values[1] == 0u;
+                               });
+    if (co_await tb_.withTimeout<test::ns>(idle, CLK_PERIOD_NS * timeout_cycles)
+        == TimeoutResult::fired) {
+        co_return;
     }
 
     if (scb_core_ != nullptr) {
@@ -299,14 +338,14 @@ UartCoreIntf::RunUserTask UartCoreIntf::wait_tx_idle(const unsigned timeout_cycl
 
 UartCoreIntf::RunUserTask UartCoreIntf::write_config_(const UartCoreConfig& cfg) {
     auto w = tb_.getCoWrite();
-    w.write(cfg_enable, cfg.enable ? 1 : 0);
-    w.write(cfg_rx_enable, cfg.rx_enable ? 1 : 0);
-    w.write(cfg_tx_enable, cfg.tx_enable ? 1 : 0);
+    w.write(cfg_enable, cfg.enable);
+    w.write(cfg_rx_enable, cfg.rx_enable);
+    w.write(cfg_tx_enable, cfg.tx_enable);
     w.write(cfg_baud_inc, cfg.baud_inc);
-    w.write(cfg_parity_mode, cfg.parity_mode & 0x3u);
-    w.write(cfg_stop_bits, cfg.stop_bits & 0x3u);
-    w.write(cfg_data_bits, cfg.data_bits & 0x3u);
-    w.write(cfg_hw_flow_enable, cfg.hw_flow_enable ? 1 : 0);
+    w.write(cfg_parity_mode, static_cast<std::uint8_t>(cfg.parity_mode & 0x3u));
+    w.write(cfg_stop_bits, static_cast<std::uint8_t>(cfg.stop_bits & 0x3u));
+    w.write(cfg_data_bits, static_cast<std::uint8_t>(cfg.data_bits & 0x3u));
+    w.write(cfg_hw_flow_enable, cfg.hw_flow_enable);
     co_await w;
     co_return;
 }
@@ -315,12 +354,12 @@ UartCoreIntf::RunUserTask UartCoreIntf::write_tx_valid_(const bool valid,
                                                         const std::uint8_t data) {
     auto w = tb_.getCoWrite();
     w.write(tx_byte_data, data);
-    w.write(tx_byte_valid, valid ? 1 : 0);
+    w.write(tx_byte_valid, valid);
     co_await w;
     co_return;
 }
 
-UartCoreIntf::RunUserTask UartCoreIntf::pulse_net_(const std::string& net) {
+UartCoreIntf::RunUserTask UartCoreIntf::pulse_net_(const TypedNet<1>& net) {
     co_await utils_.clock_to_write(1, 0);
     {
         auto w = tb_.getCoWrite();
@@ -26,6 +26,8 @@
 #define VIP_UART_CORE_AGENTS_UART_CORE_INTF_INTF_HPP
 
 #include <cstdint>
+#include <functional>
+#include <span>
 #include <string>
 
 #include "agents/uart_core_intf/intf_types.hpp"
@@ -65,6 +67,11 @@ public:
     RunUserTask set_rx_ready(bool ready);
 
     RunUserTask sample_status(UartCoreStatus& status);
+    // Event-driven status wait: resumes once pred holds for the settled status
+    // nets. 'status' is refreshed on every evaluation, so after a timeout it
+    // holds the last status seen.
+    TestBase::AwaitWatch watch_status(std::function<bool(const UartCoreStatus&)> pred,
+                                      UartCoreStatus& status);
     RunUserTask wait_tx_idle(unsigned timeout_cycles = TX_IDLE_TIMEOUT_CYCLES);
     [[nodiscard]] UartCoreEventCounts event_counts() const { return event_counts_; }
 
@@ -79,7 +86,9 @@ private:
 
     RunUserTask write_config_(const UartCoreConfig& cfg);
     RunUserTask write_tx_valid_(bool valid, std::uint8_t data);
-    RunUserTask pulse_net_(const std::string& net);
+    RunUserTask pulse_net_(const TypedNet<1>& net);
+    static void decode_status_(std::span<const unsigned long long int> values,
+                               UartCoreStatus& status);
 };
 
 } // namespace test
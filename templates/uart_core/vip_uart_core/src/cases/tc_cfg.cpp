@@ -209,7 +209,7 @@ TestBase::RunUserTask check_uart_tx_idle_high(Test& test,
         r.read(uart_tx_o);
         co_await r;
 
-        if ((r.getNum(uart_tx_o) & 1u) == 0u) {
+        if (!r.getNum(uart_tx_o)) {
             test.scb.note_fail("tc_cfg: " + label + ": uart_tx_o left idle-high state");
             co_return;
         }
@@ -95,8 +95,8 @@ TestBase::RunUserTask sample_flow(Test& test, FlowSample& sample) {
     r.read(uart_tx_o);
     co_await r;
 
-    sample.uart_rts_pin = (r.getNum(uart_rts_o) & 1u) != 0u;
-    sample.uart_tx_pin = (r.getNum(uart_tx_o) & 1u) != 0u;
+    sample.uart_rts_pin = r.getNum(uart_rts_o);
+    sample.uart_tx_pin = r.getNum(uart_tx_o);
     co_return;
 }
 
@@ -169,7 +169,7 @@ TestBase::RunUserTask drive_cts_active(Test& test, const bool active) {
     auto r = test.getCoRead();
     r.read(uart_cts_i);
     co_await r;
-    const bool physical = (r.getNum(uart_cts_i) & 1u) != 0u;
+    const bool physical = r.getNum(uart_cts_i);
     check_true(test,
                physical == cts_pin_for_active(active),
                std::string("uart_cts_i physical polarity mismatch while driving CTS ")
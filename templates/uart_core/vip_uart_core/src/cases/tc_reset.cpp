@@ -113,7 +113,7 @@ TestBase::RunUserTask drive_reset_asserted(Test& test, const bool asserted) {
     co_await test.utils.clock_to_write(1, 0);
 
     auto w = test.getCoWrite();
-    w.write(rst_n, asserted ? 0 : 1);
+    w.write(rst_n, !asserted);
     co_await w;
     co_return;
 }
@@ -144,9 +144,9 @@ TestBase::RunUserTask sample_reset(Test& test, ResetSample& sample) {
     r.read(uart_rx_i);
     co_await r;
 
-    sample.rst_pin = (r.getNum(rst_n) & 1u) != 0u;
-    sample.uart_tx_pin = (r.getNum(uart_tx_o) & 1u) != 0u;
-    sample.uart_rx_pin = (r.getNum(uart_rx_i) & 1u) != 0u;
+    sample.rst_pin = r.getNum(rst_n);
+    sample.uart_tx_pin = r.getNum(uart_tx_o);
+    sample.uart_rx_pin = r.getNum(uart_rx_i);
     co_return;
 }
 
@@ -400,7 +400,7 @@ TestBase::RunUserTask check_uart_tx_idle_high_for(Test& test,
         auto r = test.getCoRead();
         r.read(uart_tx_o);
         co_await r;
-        if ((r.getNum(uart_tx_o) & 1u) == 0u) {
+        if (!r.getNum(uart_tx_o)) {
             test.scb.note_fail("tc_reset: " + label + ": uart_tx_o left idle-high state");
             co_return;
         }
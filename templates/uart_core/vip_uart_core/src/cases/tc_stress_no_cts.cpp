@@ -34,6 +34,7 @@
 #include <cstdint>
 #include <functional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "tc_utils.hpp"
@@ -128,19 +129,13 @@ TestBase::RunUserTask wait_status(Test& test,
                                   UartCoreStatus* final_status = nullptr,
                                   const unsigned timeout_cycles =
                                       STRESS_STATUS_TIMEOUT_CYCLES) {
+    // Wake on status changes rather than sampling every cycle
     UartCoreStatus status{};
-    for (unsigned cycle = 0u; cycle < timeout_cycles; ++cycle) {
-        co_await test.core_intf.sample_status(status);
-        if (pred(status)) {
-            if (final_status != nullptr) {
-                *final_status = status;
-            }
-            co_return;
-        }
-        co_await test.utils.clock(1, 1);
+    auto watch = test.core_intf.watch_status(std::move(pred), status);
+    if (co_await test.withTimeout<test::ns>(watch, CLK_PERIOD_NS * timeout_cycles)
+        == TimeoutResult::timed_out) {
+        test.scb.note_fail("tc_stress_no_cts: " + label + ": status wait timed out");
     }
-
-    test.scb.note_fail("tc_stress_no_cts: " + label + ": status wait timed out");
     if (final_status != nullptr) {
         *final_status = status;
     }
@@ -546,12 +541,18 @@ TestBase::RunUserTask subcase_near_fifo_pressure_parallel(Test& test) {
 } // namespace
 
 TestBase::RunUserTask tc_stress_no_cts(Test& test) {
+    // Every byte here is a plain clock-timed frame: drive RX-path frames in
+    // one shot and decode TX-path frames from line edges
+    test.uart_peer_tx.set_frame_waveform(true);
+    test.uart_peer_rx.set_edge_decode(true);
 
     co_await subcase_simultaneous_rx_tx_small_burst(test);
     co_await subcase_rx_backpressure_delayed_popping(test);
     co_await subcase_tx_gaps_pause_resume(test);
     co_await subcase_mixed_legal_formats(test);
     co_await subcase_near_fifo_pressure_parallel(test);
+    test.uart_peer_tx.set_frame_waveform(false);
+    test.uart_peer_rx.set_edge_decode(false);
 
     if (!test.scb.case_has_failures()) {
         test.scb.note_pass("tc_stress_no_cts mixed no-CTS stress completed");
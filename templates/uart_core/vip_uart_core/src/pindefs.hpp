@@ -28,6 +28,8 @@
 #include <cstdint>
 #include <string>
 
+#include <rapidvpi/testbase/testbase.hpp>
+
 #include "vip_uart/common/uart_params.hpp"
 #include "vip_uart/common/uart_types.hpp"
 
@@ -75,55 +77,55 @@ static constexpr unsigned UART_DATA_8 = 3u;
 
 inline std::string dut_name = "uart_core";
 
-inline std::string clk = "clk";
-inline std::string rst_n = "rst_n";
-
-inline std::string uart_rx_i = "uart_rx_i";
-inline std::string uart_tx_o = "uart_tx_o";
-inline std::string uart_cts_i = "uart_cts_i";
-inline std::string uart_rts_o = "uart_rts_o";
-
-inline std::string cfg_enable = "cfg_enable";
-inline std::string cfg_rx_enable = "cfg_rx_enable";
-inline std::string cfg_tx_enable = "cfg_tx_enable";
-inline std::string cfg_baud_inc = "cfg_baud_inc";
-inline std::string cfg_parity_mode = "cfg_parity_mode";
-inline std::string cfg_stop_bits = "cfg_stop_bits";
-inline std::string cfg_data_bits = "cfg_data_bits";
-inline std::string cfg_hw_flow_enable = "cfg_hw_flow_enable";
-
-inline std::string ctrl_rx_fifo_clear = "ctrl_rx_fifo_clear";
-inline std::string ctrl_tx_fifo_clear = "ctrl_tx_fifo_clear";
-
-inline std::string tx_byte_valid = "tx_byte_valid";
-inline std::string tx_byte_ready = "tx_byte_ready";
-inline std::string tx_byte_data = "tx_byte_data";
-
-inline std::string rx_byte_valid = "rx_byte_valid";
-inline std::string rx_byte_ready = "rx_byte_ready";
-inline std::string rx_byte_data = "rx_byte_data";
-inline std::string rx_byte_frame_error = "rx_byte_frame_error";
-inline std::string rx_byte_parity_error = "rx_byte_parity_error";
-inline std::string rx_byte_break_detect = "rx_byte_break_detect";
-
-inline std::string rx_fifo_level = "rx_fifo_level";
-inline std::string tx_fifo_level = "tx_fifo_level";
-inline std::string rx_fifo_empty = "rx_fifo_empty";
-inline std::string rx_fifo_full = "rx_fifo_full";
-inline std::string tx_fifo_empty = "tx_fifo_empty";
-inline std::string tx_fifo_full = "tx_fifo_full";
-
-inline std::string rx_busy = "rx_busy";
-inline std::string tx_busy = "tx_busy";
-inline std::string cts_active = "cts_active";
-inline std::string rts_active = "rts_active";
-inline std::string cts_blocked = "cts_blocked";
-
-inline std::string event_rx_overrun = "event_rx_overrun";
-inline std::string event_rx_frame_error = "event_rx_frame_error";
-inline std::string event_rx_parity_error = "event_rx_parity_error";
-inline std::string event_rx_break_detect = "event_rx_break_detect";
-inline std::string event_tx_done = "event_tx_done";
+inline constinit TypedNet<1> clk{"clk"};
+inline constinit TypedNet<1> rst_n{"rst_n"};
+
+inline constinit TypedNet<1> uart_rx_i{"uart_rx_i"};
+inline constinit TypedNet<1> uart_tx_o{"uart_tx_o"};
+inline constinit TypedNet<1> uart_cts_i{"uart_cts_i"};
+inline constinit TypedNet<1> uart_rts_o{"uart_rts_o"};
+
+inline constinit TypedNet<1> cfg_enable{"cfg_enable"};
+inline constinit TypedNet<1> cfg_rx_enable{"cfg_rx_enable"};
+inline constinit TypedNet<1> cfg_tx_enable{"cfg_tx_enable"};
+inline constinit TypedNet<BAUD_ACC_W> cfg_baud_inc{"cfg_baud_inc"};
+inline constinit TypedNet<CFG_MODE_W> cfg_parity_mode{"cfg_parity_mode"};
+inline constinit TypedNet<CFG_MODE_W> cfg_stop_bits{"cfg_stop_bits"};
+inline constinit TypedNet<CFG_MODE_W> cfg_data_bits{"cfg_data_bits"};
+inline constinit TypedNet<1> cfg_hw_flow_enable{"cfg_hw_flow_enable"};
+
+inline constinit TypedNet<1> ctrl_rx_fifo_clear{"ctrl_rx_fifo_clear"};
+inline constinit TypedNet<1> ctrl_tx_fifo_clear{"ctrl_tx_fifo_clear"};
+
+inline constinit TypedNet<1> tx_byte_valid{"tx_byte_valid"};
+inline constinit TypedNet<1> tx_byte_ready{"tx_byte_ready"};
+inline constinit TypedNet<BYTE_W> tx_byte_data{"tx_byte_data"};
+
+inline constinit TypedNet<1> rx_byte_valid{"rx_byte_valid"};
+inline constinit TypedNet<1> rx_byte_ready{"rx_byte_ready"};
+inline constinit TypedNet<BYTE_W> rx_byte_data{"rx_byte_data"};
+inline constinit TypedNet<1> rx_byte_frame_error{"rx_byte_frame_error"};
+inline constinit TypedNet<1> rx_byte_parity_error{"rx_byte_parity_error"};
+inline constinit TypedNet<1> rx_byte_break_detect{"rx_byte_break_detect"};
+
+inline constinit TypedNet<FIFO_LEVEL_W> rx_fifo_level{"rx_fifo_level"};
+inline constinit TypedNet<FIFO_LEVEL_W> tx_fifo_level{"tx_fifo_level"};
+inline constinit TypedNet<1> rx_fifo_empty{"rx_fifo_empty"};
+inline constinit TypedNet<1> rx_fifo_full{"rx_fifo_full"};
+inline constinit TypedNet<1> tx_fifo_empty{"tx_fifo_empty"};
+inline constinit TypedNet<1> tx_fifo_full{"tx_fifo_full"};
+
+inline constinit TypedNet<1> rx_busy{"rx_busy"};
+inline constinit TypedNet<1> tx_busy{"tx_busy"};
+inline constinit TypedNet<1> cts_active{"cts_active"};
+inline constinit TypedNet<1> rts_active{"rts_active"};
+inline constinit TypedNet<1> cts_blocked{"cts_blocked"};
+
+inline constinit TypedNet<1> event_rx_overrun{"event_rx_overrun"};
+inline constinit TypedNet<1> event_rx_frame_error{"event_rx_frame_error"};
+inline constinit TypedNet<1> event_rx_parity_error{"event_rx_parity_error"};
+inline constinit TypedNet<1> event_rx_break_detect{"event_rx_break_detect"};
+inline constinit TypedNet<1> event_tx_done{"event_tx_done"};
 
 inline std::string uart_rx_port_name = "uart_rx";
 inline std::string uart_tx_port_name = "uart_tx";
@@ -145,8 +147,8 @@ inline std::string uart_tx_port_name = "uart_tx";
 [[nodiscard]] inline vip::uart::UartTxPortConfig make_uart_rx_serial_port() {
     vip::uart::UartTxPortConfig p{};
     p.name = uart_rx_port_name;
-    p.tx_net = uart_rx_i;
-    p.rts_net = uart_rts_o;
+    p.tx_net = uart_rx_i.name();
+    p.rts_net = uart_rts_o.name();
     p.use_rts = false;
     p.rts_active_low = true;
     return p;
@@ -155,8 +157,8 @@ inline std::string uart_tx_port_name = "uart_tx";
 [[nodiscard]] inline vip::uart::UartRxPortConfig make_uart_tx_serial_port() {
     vip::uart::UartRxPortConfig p{};
     p.name = uart_tx_port_name;
-    p.rx_net = uart_tx_o;
-    p.cts_net = uart_cts_i;
+    p.rx_net = uart_tx_o.name();
+    p.cts_net = uart_cts_i.name();
     p.drive_cts = true;
     p.cts_active_low = true;
     return p;
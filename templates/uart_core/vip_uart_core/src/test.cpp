@@ -39,16 +39,16 @@ namespace test {
 Test::Test()
     : dutName(dut_name)
     , scb(*this)
-    , utils(*this, clk)
-    , por(*this, rst_n)
-    , clock_agent(*this, clk, "clk_run")
+    , utils(*this, clk.name())
+    , por(*this, rst_n.name())
+    , clock_agent(*this, clk.name(), "clk_run")
     , uart_params(make_uart_params())
     , scb_uart_stream(scb, uart_params)
     , scb_uart_rules(scb)
     , scb_core(scb)
-    , uart_peer_tx(*this, clk, rst_n, make_uart_rx_serial_port(), uart_params)
-    , uart_peer_rx(*this, clk, rst_n, make_uart_tx_serial_port(), uart_params)
-    , core_intf(*this, clk, rst_n)
+    , uart_peer_tx(*this, clk.name(), rst_n.name(), make_uart_rx_serial_port(), uart_params)
+    , uart_peer_rx(*this, clk.name(), rst_n.name(), make_uart_tx_serial_port(), uart_params)
+    , core_intf(*this, clk.name(), rst_n.name())
     , runner(*this) {
     runner.register_tasks();
 